@@ -2,44 +2,59 @@
 #include <iomanip>
 #include <sstream>
 
-Benchmark::Benchmark(std::string name)
-    : m_name(std::move(name)), m_duration(0), m_hasEnded(false) {}
+namespace benchmark_detail {
 
-void Benchmark::start() {
-    m_startTime = std::chrono::high_resolution_clock::now();
-    m_hasEnded = false;
-}
-
-void Benchmark::end() {
-    if (!m_hasEnded) {
-        auto endTime = std::chrono::high_resolution_clock::now();
-        m_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - m_startTime);
-        m_hasEnded = true;
-    }
-}
-
-std::string Benchmark::toString() const {
-    if (!m_hasEnded) {
-        return "Benchmark '" + m_name + "' has not ended yet.";
-    }
-
-    auto us = std::chrono::duration_cast<std::chrono::microseconds>(m_duration);
-    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(m_duration);
+std::string formatReport(const std::string& name, std::chrono::nanoseconds duration,
+                         const std::uint64_t* cycles, const PerfCounterGroup* counters,
+                         const CounterValues& counterValues) {
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(duration);
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(duration);
 
     // Human-readable s:ms:us format
-    auto s_part = std::chrono::duration_cast<std::chrono::seconds>(m_duration);
-    auto ms_part = std::chrono::duration_cast<std::chrono::milliseconds>(m_duration - s_part);
-    auto us_part = std::chrono::duration_cast<std::chrono::microseconds>(m_duration - s_part - ms_part);
+    auto s_part = std::chrono::duration_cast<std::chrono::seconds>(duration);
+    auto ms_part = std::chrono::duration_cast<std::chrono::milliseconds>(duration - s_part);
+    auto us_part = std::chrono::duration_cast<std::chrono::microseconds>(duration - s_part - ms_part);
 
     std::stringstream ss;
-    ss << "--- Benchmark: '" << m_name << "' ---\n"
+    ss << "--- Benchmark: '" << name << "' ---\n";
+    if (cycles != nullptr) {
+        ss << "  CPU cycles: " << *cycles << "\n";
+    }
+    ss << "  Nanoseconds: " << duration.count() << " ns\n"
        << "  Microseconds: " << us.count() << " µs\n"
        << "  Milliseconds: " << ms.count() << " ms\n"
        << "  Human-readable: "
        << std::setfill('0') << std::setw(2) << s_part.count() << "s : "
        << std::setfill('0') << std::setw(3) << ms_part.count() << "ms : "
-       << std::setfill('0') << std::setw(3) << us_part.count() << "µs\n"
-       << "-------------------------------------";
+       << std::setfill('0') << std::setw(3) << us_part.count() << "µs\n";
+    ss << std::setfill(' ');
+
+    if (counters != nullptr) {
+        if (!counters->available()) {
+            ss << "  Hardware counters: unavailable, time-only (" << counters->error() << ")\n";
+        } else {
+            ss << "  Hardware counters:\n";
+            for (std::size_t i = 0; i < kPerfCounterCount; ++i) {
+                const auto counter = static_cast<PerfCounter>(i);
+                ss << "    " << std::left << std::setw(18) << perfCounterName(counter) << std::right;
+                if (counterValues.has(counter)) {
+                    ss << counterValues[counter] << "\n";
+                } else {
+                    ss << "n/a\n";
+                }
+            }
+            if (counterValues.ipc() > 0.0) {
+                ss << "    " << std::left << std::setw(18) << "IPC" << std::right
+                   << std::fixed << std::setprecision(2) << counterValues.ipc() << "\n";
+            }
+            if (!counters->error().empty()) {
+                ss << "    n/a: " << counters->error() << "\n";
+            }
+        }
+    }
+    ss << "-------------------------------------";
 
     return ss.str();
-}
\ No newline at end of file
+}
+
+} // namespace benchmark_detail
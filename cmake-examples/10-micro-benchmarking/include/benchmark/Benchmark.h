@@ -1,79 +1,205 @@
 #ifndef BENCHMARK_H
 #define BENCHMARK_H
 
+#include "benchmark/Clock.h"
+#include "benchmark/PerfCounters.h"
+#include "benchmark/SampleCollector.h"
+#include "benchmark/ScopeProfiler.h"
 #include <chrono>
-#include <iostream>
+#include <cstdint>
 #include <string>
 
 // --- Public Interface ---
 
-// Forward declaration for the ScopedBenchmark helper class
-class ScopedBenchmark;
+/**
+ * TimeOnly measures wall time. HardwareCounters additionally reads a perf_event
+ * counter group (instructions, cycles, cache and branch misses, context switches)
+ * around the region. If the counters cannot be opened the benchmark falls back
+ * to time-only and says so in its report.
+ */
+enum class BenchmarkMode { TimeOnly, HardwareCounters };
 
 /**
- * @class Benchmark
+ * @class BasicBenchmark
  * @brief A manual-start/stop benchmarking tool.
  *
+ * The clock is a policy (see Clock.h): ChronoClock is portable, TscClock reads
+ * the CPU Time Stamp Counter and reports cycles next to nanoseconds.
+ * The cost of the clock reads is measured once and subtracted from the result.
+ * With BenchmarkMode::HardwareCounters the report also lists the counters of the region.
+ * A counter group belongs to a thread: start() and end() must run on the thread that
+ * constructed the benchmark.
+ *
  * Example:
- *   Benchmark b("My Test");
+ *   Benchmark b("My Test");        // or TscBenchmark for cycle counts
  *   b.start();
  *   // code to measure
  *   b.end();
  *   std::cout << b.toString() << std::endl;
  */
-class Benchmark {
+template <typename ClockPolicy>
+class BasicBenchmark {
 public:
-    explicit Benchmark(std::string name);
+    explicit BasicBenchmark(std::string name, BenchmarkMode mode = BenchmarkMode::TimeOnly)
+        : m_name(std::move(name)),
+          m_counters(mode == BenchmarkMode::HardwareCounters ? &PerfCounterGroup::forCurrentThread() : nullptr),
+          m_startTicks(0),
+          m_elapsedTicks(0),
+          m_hasEnded(false) {}
+
+    void start() {
+        m_hasEnded = false;
+        // Counters are read outside the timed region so their syscall is not timed.
+        if (m_counters != nullptr) {
+            m_counterStart = m_counters->read();
+        }
+        m_startTicks = ClockPolicy::start();
+    }
+
+    void end() {
+        if (!m_hasEnded) {
+            std::uint64_t endTicks = ClockPolicy::end();
+            if (m_counters != nullptr) {
+                m_counterDelta = CounterValues::delta(m_counterStart, m_counters->read());
+            }
+            std::uint64_t raw = endTicks - m_startTicks;
+            std::uint64_t overhead = ClockPolicy::overhead();
+            m_elapsedTicks = raw > overhead ? raw - overhead : 0;
+            m_hasEnded = true;
+        }
+    }
 
-    void start();
-    void end();
+    // Elapsed time in clock ticks (cycles for TscClock), clock overhead subtracted.
+    std::uint64_t elapsedTicks() const { return m_elapsedTicks; }
+
+    std::chrono::nanoseconds elapsed() const {
+        return std::chrono::nanoseconds(
+            static_cast<std::int64_t>(ClockPolicy::toNanoseconds(m_elapsedTicks)));
+    }
+
+    // Counter deltas of the last start()/end() pair; empty in time-only mode.
+    const CounterValues& counters() const { return m_counterDelta; }
 
     // Returns a formatted string with all timing statistics.
     std::string toString() const;
 
 private:
-    friend class ScopedBenchmark; // Allow ScopedBenchmark to access private members
-
     std::string m_name;
-    std::chrono::high_resolution_clock::time_point m_startTime;
-    std::chrono::nanoseconds m_duration;
+    PerfCounterGroup* m_counters;  // owned by the thread, null in time-only mode
+    CounterValues m_counterStart;
+    CounterValues m_counterDelta;
+    std::uint64_t m_startTicks;
+    std::uint64_t m_elapsedTicks;
     bool m_hasEnded;
 };
 
+using Benchmark = BasicBenchmark<ChronoClock>;
+using TscBenchmark = BasicBenchmark<TscClock>;
+
+namespace benchmark_detail {
+
+// Shared by all clock policies; `cycles` is null when the clock does not count cycles,
+// `counters` is null in time-only mode.
+std::string formatReport(const std::string& name, std::chrono::nanoseconds duration,
+                         const std::uint64_t* cycles, const PerfCounterGroup* counters,
+                         const CounterValues& counterValues);
+
+} // namespace benchmark_detail
+
+template <typename ClockPolicy>
+std::string BasicBenchmark<ClockPolicy>::toString() const {
+    if (!m_hasEnded) {
+        return "Benchmark '" + m_name + "' has not ended yet.";
+    }
+    const std::uint64_t* cycles = ClockPolicy::countsCycles ? &m_elapsedTicks : nullptr;
+    return benchmark_detail::formatReport(m_name, elapsed(), cycles, m_counters, m_counterDelta);
+}
+
+
+// The clock used by the benchmark(name) macro. Override with -DBENCHMARK_CLOCK=TscClock.
+#ifndef BENCHMARK_CLOCK
+    #define BENCHMARK_CLOCK ChronoClock
+#endif
+
+// Define BENCHMARK_CALL_TREE to also record the benchmark(name) scopes as a call tree
+// (ScopeProfiler). Off by default: it adds a child lookup per scope entry.
+#ifdef BENCHMARK_CALL_TREE
+    constexpr bool kBenchmarkCallTree = true;
+#else
+    constexpr bool kBenchmarkCallTree = false;
+#endif
+
+#define BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_IMPL(a, b)
 
 #ifdef ENABLE_BENCHMARK
     // The macro creates a uniquely named ScopedBenchmark object that lives for the current scope.
-    // The ##__LINE__ ensures you can have multiple benchmarks in the same function.
-    #define benchmark(name) ScopedBenchmark bench_##__LINE__(name)
+    // The __LINE__ suffix ensures you can have multiple benchmarks in the same function
+    // (the indirection through BENCHMARK_CONCAT is needed, otherwise ## pastes the literal
+    // token "__LINE__" instead of the line number).
+    // `name` must be a string literal: only the pointer is stored with each sample.
+    #define benchmark(name) ScopedBenchmark BENCHMARK_CONCAT(bench_, __LINE__)(name)
+    // Same, plus hardware counters for the scope (falls back to time-only if unavailable).
+    #define benchmark_counters(name) CountingScopedBenchmark BENCHMARK_CONCAT(bench_, __LINE__)(name)
 #else
     // If benchmarking is disabled, the macro expands to nothing, incurring zero overhead.
     #define benchmark(name)
+    #define benchmark_counters(name)
 #endif
 
 
 // --- Implementation Detail (Helper Class for RAII) ---
 
 /**
- * @class ScopedBenchmark
+ * @class BasicScopedBenchmark
  * @brief An RAII-style benchmarking tool.
  *
- * It starts the timer on construction and stops it on destruction (when it goes out of scope),
- * automatically printing the results. Use the `benchmark("name")` macro for convenience.
+ * It starts the timer on construction and stops it on destruction (when it goes out of scope).
+ * The destructor does no formatting or I/O: it pushes one fixed-size sample into the
+ * calling thread's lock-free buffer and the SampleCollector aggregates it in the background.
+ * With WithCounters the sample also carries the hardware counter deltas of the scope.
+ * With WithCallTree nested scopes on the same thread are also recorded as a call tree
+ * by ScopeProfiler (see BENCHMARK_CALL_TREE).
+ * Use the `benchmark("name")` / `benchmark_counters("name")` macros for convenience.
  */
-class ScopedBenchmark {
+template <typename ClockPolicy, bool WithCounters = false, bool WithCallTree = false>
+class BasicScopedBenchmark {
 public:
-    explicit ScopedBenchmark(std::string name) : m_benchmark(std::move(name)) {
-        m_benchmark.start();
+    explicit BasicScopedBenchmark(const char* name)
+        : m_name(name), m_node(WithCallTree ? ScopeProfiler::enter(name) : nullptr) {
+        if constexpr (WithCounters) {
+            m_counterStart = PerfCounterGroup::forCurrentThread().read();
+        }
+        m_startTicks = ClockPolicy::start();
     }
 
-    ~ScopedBenchmark() {
-        m_benchmark.end();
-        // Automatically print on destruction
-        std::cout << m_benchmark.toString() << std::endl;
+    ~BasicScopedBenchmark() {
+        std::uint64_t ticks = ClockPolicy::end() - m_startTicks;
+        Sample sample{m_name, 0, CounterValues{}};
+        if constexpr (WithCounters) {
+            sample.counters = CounterValues::delta(m_counterStart, PerfCounterGroup::forCurrentThread().read());
+        }
+        std::uint64_t overhead = ClockPolicy::overhead();
+        ticks = ticks > overhead ? ticks - overhead : 0;
+        sample.durationNs = static_cast<std::uint64_t>(ClockPolicy::toNanoseconds(ticks));
+        SampleCollector::record(sample);
+        if constexpr (WithCallTree) {
+            ScopeProfiler::exit(m_node, static_cast<std::uint64_t>(ClockPolicy::toNanoseconds(m_startTicks)),
+                                sample.durationNs);
+        }
     }
 
+    BasicScopedBenchmark(const BasicScopedBenchmark&) = delete;
+    BasicScopedBenchmark& operator=(const BasicScopedBenchmark&) = delete;
+
 private:
-    Benchmark m_benchmark;
+    const char* m_name;
+    CallNode* m_node;  // null without WithCallTree
+    std::uint64_t m_startTicks = 0;
+    CounterValues m_counterStart;
 };
 
-#endif // BENCHMARK_H
\ No newline at end of file
+using ScopedBenchmark = BasicScopedBenchmark<BENCHMARK_CLOCK, false, kBenchmarkCallTree>;
+using CountingScopedBenchmark = BasicScopedBenchmark<BENCHMARK_CLOCK, true, kBenchmarkCallTree>;
+
+#endif // BENCHMARK_H
@@ -0,0 +1,120 @@
+#include "benchmark/BenchmarkRunner.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+
+namespace {
+
+// z-value for a two-sided 95% confidence interval (normal approximation).
+constexpr double kZ95 = 1.96;
+
+// Percentile with linear interpolation between closest ranks.
+// `sorted` must be sorted ascending and non-empty.
+double percentile(const std::vector<double>& sorted, double p) {
+    const double rank = p * static_cast<double>(sorted.size() - 1);
+    const auto lower = static_cast<std::size_t>(std::floor(rank));
+    const auto upper = static_cast<std::size_t>(std::ceil(rank));
+    const double fraction = rank - static_cast<double>(lower);
+    return sorted[lower] + (sorted[upper] - sorted[lower]) * fraction;
+}
+
+} // namespace
+
+BenchmarkStats BenchmarkStats::fromSamples(std::vector<double> samples) {
+    BenchmarkStats stats;
+    stats.iterations = samples.size();
+    if (samples.empty()) {
+        return stats;
+    }
+
+    std::vector<double> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+
+    const double n = static_cast<double>(sorted.size());
+    stats.min = sorted.front();
+    stats.max = sorted.back();
+    stats.median = percentile(sorted, 0.5);
+    stats.p90 = percentile(sorted, 0.90);
+    stats.p99 = percentile(sorted, 0.99);
+    stats.p999 = percentile(sorted, 0.999);
+    stats.mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / n;
+
+    double sumSq = 0.0;
+    for (double s : sorted) {
+        sumSq += (s - stats.mean) * (s - stats.mean);
+    }
+    stats.stddev = sorted.size() > 1 ? std::sqrt(sumSq / (n - 1.0)) : 0.0;
+    stats.ciHalfWidth = kZ95 * stats.stddev / std::sqrt(n);
+    stats.samples = std::move(samples);
+    return stats;
+}
+
+BenchmarkRunner::BenchmarkRunner(std::string name, RunnerConfig config)
+    : m_name(std::move(name)), m_config(config) {}
+
+void BenchmarkRunner::record(double sampleNs) {
+    m_samples.push_back(sampleNs);
+
+    // Welford's online algorithm: numerically stable running variance.
+    const double n = static_cast<double>(m_samples.size());
+    const double delta = sampleNs - m_runningMean;
+    m_runningMean += delta / n;
+    m_runningM2 += delta * (sampleNs - m_runningMean);
+}
+
+bool BenchmarkRunner::isPreciseEnough() const {
+    const double n = static_cast<double>(m_samples.size());
+    if (n < 2.0 || m_runningMean <= 0.0) {
+        return false;
+    }
+    const double stddev = std::sqrt(m_runningM2 / (n - 1.0));
+    const double halfWidth = kZ95 * stddev / std::sqrt(n);
+    return halfWidth <= m_config.targetRelativeCi * m_runningMean;
+}
+
+void BenchmarkRunner::finish(bool converged, const char* clock, double cyclesPerNs) {
+    m_stats = BenchmarkStats::fromSamples(m_samples);
+    m_stats.converged = converged;
+    m_stats.clock = clock;
+    m_stats.cyclesPerNs = cyclesPerNs;
+}
+
+std::string BenchmarkRunner::toString() const {
+    if (m_stats.iterations == 0) {
+        return "BenchmarkRunner '" + m_name + "' has not run yet.";
+    }
+
+    // Microseconds, plus CPU cycles when the clock counts them.
+    const double cyclesPerNs = m_stats.cyclesPerNs;
+    auto us = [cyclesPerNs](double ns) {
+        std::stringstream value;
+        value << std::fixed << std::setprecision(3) << ns / 1000.0 << " µs";
+        if (cyclesPerNs > 0.0) {
+            value << " (" << std::setprecision(0) << ns * cyclesPerNs << " cycles)";
+        }
+        return value.str();
+    };
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    ss << "--- Benchmark: '" << m_name << "' ---\n"
+       << "  Iterations: " << m_stats.iterations
+       << " (warmup " << m_config.warmupIterations << "), clock: " << m_stats.clock;
+    if (m_config.adaptive) {
+        ss << (m_stats.converged ? ", converged" : ", NOT converged");
+    }
+    ss << "\n"
+       << "  Min:     " << us(m_stats.min) << "\n"
+       << "  Median:  " << us(m_stats.median) << "\n"
+       << "  Mean:    " << us(m_stats.mean) << " (±" << us(m_stats.ciHalfWidth) << ", 95% CI)\n"
+       << "  Stddev:  " << us(m_stats.stddev) << "\n"
+       << "  p90:     " << us(m_stats.p90) << "\n"
+       << "  p99:     " << us(m_stats.p99) << "\n"
+       << "  p99.9:   " << us(m_stats.p999) << "\n"
+       << "  Max:     " << us(m_stats.max) << "\n"
+       << "-------------------------------------";
+
+    return ss.str();
+}
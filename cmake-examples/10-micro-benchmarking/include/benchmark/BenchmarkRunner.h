@@ -0,0 +1,183 @@
+#ifndef BENCHMARK_RUNNER_H
+#define BENCHMARK_RUNNER_H
+
+#include "benchmark/Clock.h"
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Prevents the compiler from optimizing away a computed value.
+ *
+ * The empty asm statement tells the compiler that `value` is read by code it
+ * cannot see, so the computation producing it must actually happen.
+ */
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @struct RunnerConfig
+ * @brief Controls how many times BenchmarkRunner executes the measured callable.
+ *
+ * Fixed mode runs exactly `iterations` timed iterations.
+ * Adaptive mode keeps running until the 95% confidence interval of the mean is
+ * within `targetRelativeCi` of the mean (or a hard limit is reached).
+ */
+struct RunnerConfig {
+    std::size_t warmupIterations = 10;
+
+    // Fixed mode
+    std::size_t iterations = 100;
+
+    // Adaptive mode
+    bool adaptive = false;
+    std::size_t minIterations = 10;
+    std::size_t maxIterations = 1'000'000;
+    double targetRelativeCi = 0.01;                // 1% of the mean
+    std::chrono::nanoseconds maxTime = std::chrono::seconds(10);
+};
+
+/**
+ * @struct BenchmarkStats
+ * @brief Summary statistics over all timed iterations. All values are in nanoseconds.
+ */
+struct BenchmarkStats {
+    std::size_t iterations = 0;
+    double min = 0.0;
+    double median = 0.0;
+    double mean = 0.0;
+    double stddev = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double p999 = 0.0;
+    double max = 0.0;
+    double ciHalfWidth = 0.0;   // 95% confidence interval half-width of the mean
+    bool converged = true;      // false if adaptive mode hit a limit first
+    const char* clock = ChronoClock::name;
+    double cyclesPerNs = 0.0;   // non-zero when the clock counts CPU cycles
+    std::vector<double> samples;
+
+    // Builds the summary from raw per-iteration samples.
+    static BenchmarkStats fromSamples(std::vector<double> samples);
+};
+
+/**
+ * @class BenchmarkRunner
+ * @brief Runs a callable many times and reports the latency distribution.
+ *
+ * A single start/end pair can land on a cold cache or a context switch.
+ * The runner executes warmup iterations first, then times every iteration
+ * separately so that min/median/percentiles can be reported.
+ * The clock policy is selectable per run; the clock overhead is subtracted
+ * from every sample.
+ *
+ * Example:
+ *   BenchmarkRunner runner("Portfolio Risk");
+ *   runner.run([&] { return calculatePortfolioRisk(orders); });
+ *   // or: runner.run<TscClock>(...) to also report CPU cycles
+ *   std::cout << runner.toString() << std::endl;
+ */
+class BenchmarkRunner {
+public:
+    explicit BenchmarkRunner(std::string name, RunnerConfig config = {});
+
+    template <typename ClockPolicy = ChronoClock, typename Func>
+    const BenchmarkStats& run(Func&& func);
+
+    const BenchmarkStats& stats() const { return m_stats; }
+
+    // Returns a formatted string with all statistics.
+    std::string toString() const;
+
+private:
+    template <typename Func>
+    static void invokeOnce(Func& func);
+
+    // Times one invocation, returns nanoseconds with the clock overhead subtracted.
+    template <typename ClockPolicy, typename Func>
+    static double timeOnce(Func& func, std::uint64_t overhead);
+
+    // Adaptive mode: true once the confidence interval is tight enough.
+    bool isPreciseEnough() const;
+
+    void record(double sampleNs);
+    void finish(bool converged, const char* clock, double cyclesPerNs);
+
+    std::string m_name;
+    RunnerConfig m_config;
+    std::vector<double> m_samples;
+    BenchmarkStats m_stats;
+
+    // Welford running mean/variance, used by the adaptive stop rule.
+    double m_runningMean = 0.0;
+    double m_runningM2 = 0.0;
+};
+
+// --- Template implementation ---
+
+template <typename Func>
+void BenchmarkRunner::invokeOnce(Func& func) {
+    if constexpr (std::is_void_v<std::invoke_result_t<Func&>>) {
+        func();
+    } else {
+        auto result = func();
+        doNotOptimize(result);
+    }
+}
+
+template <typename ClockPolicy, typename Func>
+double BenchmarkRunner::timeOnce(Func& func, std::uint64_t overhead) {
+    std::uint64_t start = ClockPolicy::start();
+    invokeOnce(func);
+    std::uint64_t end = ClockPolicy::end();
+    std::uint64_t ticks = end - start;
+    return ClockPolicy::toNanoseconds(ticks > overhead ? ticks - overhead : 0);
+}
+
+template <typename ClockPolicy, typename Func>
+const BenchmarkStats& BenchmarkRunner::run(Func&& func) {
+    m_samples.clear();
+    m_runningMean = 0.0;
+    m_runningM2 = 0.0;
+
+    const std::uint64_t overhead = ClockPolicy::overhead();
+    const double cyclesPerNs = ClockPolicy::countsCycles ? 1.0 / ClockPolicy::toNanoseconds(1) : 0.0;
+
+    for (std::size_t i = 0; i < m_config.warmupIterations; ++i) {
+        invokeOnce(func);
+    }
+
+    if (!m_config.adaptive) {
+        m_samples.reserve(m_config.iterations);
+        for (std::size_t i = 0; i < m_config.iterations; ++i) {
+            record(timeOnce<ClockPolicy>(func, overhead));
+        }
+        finish(true, ClockPolicy::name, cyclesPerNs);
+        return m_stats;
+    }
+
+    using Deadline = std::chrono::steady_clock;
+    const auto deadline = Deadline::now() + m_config.maxTime;
+    bool converged = false;
+    while (m_samples.size() < m_config.maxIterations) {
+        record(timeOnce<ClockPolicy>(func, overhead));
+
+        if (m_samples.size() >= m_config.minIterations && isPreciseEnough()) {
+            converged = true;
+            break;
+        }
+        if (Deadline::now() >= deadline) {
+            break;
+        }
+    }
+    finish(converged, ClockPolicy::name, cyclesPerNs);
+    return m_stats;
+}
+
+#endif // BENCHMARK_RUNNER_H
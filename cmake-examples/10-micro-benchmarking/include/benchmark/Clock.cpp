@@ -0,0 +1,69 @@
+#include "benchmark/Clock.h"
+#include <algorithm>
+#include <array>
+
+#if BENCHMARK_HAS_TSC
+    #include <cpuid.h>
+#endif
+
+std::uint64_t ChronoClock::overhead() {
+    static const std::uint64_t ticks = measureClockOverhead<ChronoClock>();
+    return ticks;
+}
+
+#if BENCHMARK_HAS_TSC
+
+namespace {
+
+bool detectInvariantTsc() {
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid_max(0x80000000, nullptr) < 0x80000007) {
+        return false;
+    }
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+    return (edx & (1u << 8)) != 0;
+}
+
+// Counts TSC ticks over a ~10ms steady_clock window.
+double measureCyclesPerNs() {
+    using Clock = std::chrono::steady_clock;
+    const auto window = std::chrono::milliseconds(10);
+
+    const auto t0 = Clock::now();
+    const std::uint64_t c0 = TscClock::start();
+    auto t1 = t0;
+    while (t1 - t0 < window) {
+        t1 = Clock::now();
+    }
+    const std::uint64_t c1 = TscClock::end();
+
+    const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+    return static_cast<double>(c1 - c0) / ns;
+}
+
+// Calibrate during static initialization, not on the first measurement.
+[[maybe_unused]] const TscCalibration& g_eagerCalibration = TscCalibration::instance();
+
+} // namespace
+
+TscCalibration::TscCalibration() : m_cyclesPerNs(0.0), m_invariant(detectInvariantTsc()) {
+    // Median of three windows: a preemption during one window cannot skew the result.
+    std::array<double, 3> rounds{};
+    for (double& r : rounds) {
+        r = measureCyclesPerNs();
+    }
+    std::sort(rounds.begin(), rounds.end());
+    m_cyclesPerNs = rounds[1];
+}
+
+const TscCalibration& TscCalibration::instance() {
+    static const TscCalibration calibration;
+    return calibration;
+}
+
+std::uint64_t TscClock::overhead() {
+    static const std::uint64_t ticks = measureClockOverhead<TscClock>();
+    return ticks;
+}
+
+#endif // BENCHMARK_HAS_TSC
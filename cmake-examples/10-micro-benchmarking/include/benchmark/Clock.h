@@ -0,0 +1,136 @@
+#ifndef BENCHMARK_CLOCK_H
+#define BENCHMARK_CLOCK_H
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define BENCHMARK_HAS_TSC 1
+#else
+    #define BENCHMARK_HAS_TSC 0
+#endif
+
+/*
+ * Clock policies for Benchmark, ScopedBenchmark and BenchmarkRunner.
+ *
+ * Every policy provides the same static interface:
+ *   name              - printable name of the clock
+ *   countsCycles      - true if ticks are CPU cycles
+ *   start() / end()   - raw tick readings around the measured region
+ *   toNanoseconds()   - converts a tick delta to nanoseconds
+ *   overhead()        - ticks measured for an empty region (cost of the clock itself)
+ */
+
+/**
+ * @struct ChronoClock
+ * @brief Portable clock based on std::chrono::steady_clock. One tick is one nanosecond.
+ */
+struct ChronoClock {
+    static constexpr const char* name = "chrono";
+    static constexpr bool countsCycles = false;
+
+    static std::uint64_t start() noexcept { return now(); }
+    static std::uint64_t end() noexcept { return now(); }
+
+    static double toNanoseconds(std::uint64_t ticks) noexcept {
+        return static_cast<double>(ticks);
+    }
+
+    static std::uint64_t overhead();
+
+private:
+    static std::uint64_t now() noexcept {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+};
+
+#if BENCHMARK_HAS_TSC
+
+/**
+ * @class TscCalibration
+ * @brief Measures the TSC frequency against steady_clock once per process.
+ *
+ * Calibration runs during static initialization of the benchmark library,
+ * so the first measurement does not pay for it.
+ */
+class TscCalibration {
+public:
+    static const TscCalibration& instance();
+
+    double cyclesPerNs() const { return m_cyclesPerNs; }
+
+    // CPUID.80000007H:EDX[8]. Without an invariant TSC the counter rate follows
+    // the core frequency (P-states, turbo), so cycles cannot be converted to time.
+    bool isInvariant() const { return m_invariant; }
+
+private:
+    TscCalibration();
+
+    double m_cyclesPerNs;
+    bool m_invariant;
+};
+
+/**
+ * @struct TscClock
+ * @brief Clock based on the CPU Time Stamp Counter. One tick is one reference cycle.
+ *
+ * Reads are serialized so the measured instructions cannot move outside the region:
+ *   start: lfence; rdtsc; lfence   - earlier instructions finish, later ones wait for the read
+ *   end:   rdtscp; lfence          - rdtscp waits for the region, lfence blocks what follows
+ * lfence is used instead of cpuid because cpuid traps to the hypervisor on virtual
+ * machines and costs hundreds of cycles there.
+ */
+struct TscClock {
+    static constexpr const char* name = "tsc";
+    static constexpr bool countsCycles = true;
+
+    static std::uint64_t start() noexcept {
+        _mm_lfence();
+        std::uint64_t t = __rdtsc();
+        _mm_lfence();
+        return t;
+    }
+
+    static std::uint64_t end() noexcept {
+        unsigned int aux;
+        std::uint64_t t = __rdtscp(&aux);
+        _mm_lfence();
+        return t;
+    }
+
+    static double toNanoseconds(std::uint64_t cycles) noexcept {
+        return static_cast<double>(cycles) / TscCalibration::instance().cyclesPerNs();
+    }
+
+    static std::uint64_t overhead();
+};
+
+#else
+
+// No TSC on this architecture: fall back to the portable clock.
+using TscClock = ChronoClock;
+
+#endif // BENCHMARK_HAS_TSC
+
+/**
+ * @brief Smallest tick count observed for an empty start()/end() region.
+ *
+ * The minimum (not the mean) is used: it is the cost of the clock reads themselves,
+ * without interrupts or cache misses added on top.
+ */
+template <typename ClockPolicy>
+std::uint64_t measureClockOverhead(int rounds = 1000) {
+    std::uint64_t best = UINT64_MAX;
+    for (int i = 0; i < rounds; ++i) {
+        std::uint64_t start = ClockPolicy::start();
+        std::uint64_t end = ClockPolicy::end();
+        if (end - start < best) {
+            best = end - start;
+        }
+    }
+    return best;
+}
+
+#endif // BENCHMARK_CLOCK_H
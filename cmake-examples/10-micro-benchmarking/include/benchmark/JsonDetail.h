@@ -0,0 +1,37 @@
+#ifndef BENCHMARK_JSON_DETAIL_H
+#define BENCHMARK_JSON_DETAIL_H
+
+// Internal to the benchmark library: the JSON string escaping shared by the result
+// store and the scope profiler, so both emitters (and ResultStore's reader) agree.
+
+#include <iomanip>
+#include <ostream>
+#include <string_view>
+
+namespace benchmark_detail {
+
+// Writes `text` as a quoted JSON string. Quotes, backslashes and control characters
+// are escaped; other bytes (including UTF-8) are written as they are.
+inline void writeJsonString(std::ostream& out, std::string_view text) {
+    out << '"';
+    for (char c : text) {
+        switch (c) {
+            case '"':  out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                        << static_cast<int>(c) << std::dec << std::setfill(' ');
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+}
+
+} // namespace benchmark_detail
+
+#endif // BENCHMARK_JSON_DETAIL_H
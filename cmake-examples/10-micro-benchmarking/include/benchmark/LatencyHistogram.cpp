@@ -0,0 +1,72 @@
+#include "benchmark/LatencyHistogram.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+LatencyHistogram::LatencyHistogram()
+    : m_buckets(kBucketCount, 0),
+      m_count(0),
+      m_min(std::numeric_limits<std::uint64_t>::max()),
+      m_max(0),
+      m_sum(0.0L) {}
+
+std::size_t LatencyHistogram::indexOf(std::uint64_t value) noexcept {
+    if (value < kSubBucketCount) {
+        return static_cast<std::size_t>(value);
+    }
+    // Position of the highest set bit selects the power-of-two range,
+    // the next 7 bits select the linear sub-bucket inside it.
+    const unsigned msb = 63u - static_cast<unsigned>(__builtin_clzll(value));
+    const unsigned shift = msb - (kSubBucketBits - 1);
+    return static_cast<std::size_t>(kSubBucketHalf * shift + (value >> shift));
+}
+
+std::uint64_t LatencyHistogram::highestValueAt(std::size_t index) noexcept {
+    if (index < kSubBucketCount) {
+        return index;
+    }
+    const unsigned shift = static_cast<unsigned>(index / kSubBucketHalf) - 1;
+    const std::uint64_t subBucket = index % kSubBucketHalf + kSubBucketHalf;
+    // Wraps to UINT64_MAX for the very last bucket, which is the intended upper bound.
+    return ((subBucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(std::uint64_t valueNs) noexcept {
+    ++m_buckets[indexOf(valueNs)];
+    ++m_count;
+    m_min = std::min(m_min, valueNs);
+    m_max = std::max(m_max, valueNs);
+    m_sum += valueNs;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (std::size_t i = 0; i < kBucketCount; ++i) {
+        m_buckets[i] += other.m_buckets[i];
+    }
+    m_count += other.m_count;
+    m_min = std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+    m_sum += other.m_sum;
+}
+
+double LatencyHistogram::mean() const {
+    return m_count ? static_cast<double>(m_sum / m_count) : 0.0;
+}
+
+std::uint64_t LatencyHistogram::percentile(double quantile) const {
+    if (m_count == 0) {
+        return 0;
+    }
+    quantile = std::clamp(quantile, 0.0, 1.0);
+    const auto target = std::max<std::uint64_t>(
+        1, static_cast<std::uint64_t>(std::ceil(quantile * static_cast<double>(m_count))));
+
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < kBucketCount; ++i) {
+        seen += m_buckets[i];
+        if (seen >= target) {
+            return std::clamp(highestValueAt(i), min(), m_max);
+        }
+    }
+    return m_max;
+}
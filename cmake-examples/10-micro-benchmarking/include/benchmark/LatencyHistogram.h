@@ -0,0 +1,50 @@
+#ifndef BENCHMARK_LATENCY_HISTOGRAM_H
+#define BENCHMARK_LATENCY_HISTOGRAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class LatencyHistogram
+ * @brief HDR-style log-linear histogram of nanosecond latencies.
+ *
+ * Values below 256 ns get one bucket each. Above that, every power-of-two range
+ * is split into 128 equal buckets, so any recorded value is reproduced within
+ * 1/128 (< 0.8%) relative error, from 1 ns up to the full 64-bit range.
+ * Recording is O(1) with a fixed memory footprint (~58 KB) regardless of the
+ * sample count, and histograms from different threads can be merged.
+ */
+class LatencyHistogram {
+public:
+    LatencyHistogram();
+
+    void record(std::uint64_t valueNs) noexcept;
+    void merge(const LatencyHistogram& other);
+
+    std::uint64_t count() const { return m_count; }
+    std::uint64_t min() const { return m_count ? m_min : 0; }
+    std::uint64_t max() const { return m_max; }
+    double mean() const;
+
+    // Value at the given quantile (0.0 - 1.0), e.g. 0.99 for p99.
+    std::uint64_t percentile(double quantile) const;
+
+private:
+    static constexpr unsigned kSubBucketBits = 8;
+    static constexpr std::uint64_t kSubBucketCount = 1ull << kSubBucketBits;   // 256
+    static constexpr std::uint64_t kSubBucketHalf = kSubBucketCount / 2;       // 128
+    static constexpr std::size_t kBucketCount =
+        kSubBucketCount + (64 - kSubBucketBits) * kSubBucketHalf;
+
+    static std::size_t indexOf(std::uint64_t value) noexcept;
+    static std::uint64_t highestValueAt(std::size_t index) noexcept;
+
+    std::vector<std::uint64_t> m_buckets;
+    std::uint64_t m_count;
+    std::uint64_t m_min;
+    std::uint64_t m_max;
+    long double m_sum;
+};
+
+#endif // BENCHMARK_LATENCY_HISTOGRAM_H
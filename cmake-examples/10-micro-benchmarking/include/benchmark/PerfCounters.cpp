@@ -0,0 +1,169 @@
+#include "benchmark/PerfCounters.h"
+#include <cerrno>
+#include <cstring>
+#include <memory>
+
+#ifdef __linux__
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+const char* perfCounterName(PerfCounter counter) {
+    switch (counter) {
+        case PerfCounter::Instructions:    return "instructions";
+        case PerfCounter::Cycles:          return "cycles";
+        case PerfCounter::L1DMisses:       return "L1D misses";
+        case PerfCounter::LLCMisses:       return "LLC misses";
+        case PerfCounter::BranchMisses:    return "branch misses";
+        case PerfCounter::ContextSwitches: return "context switches";
+        case PerfCounter::Count:           break;
+    }
+    return "unknown";
+}
+
+double CounterValues::ipc() const {
+    if (!has(PerfCounter::Instructions) || !has(PerfCounter::Cycles) || (*this)[PerfCounter::Cycles] == 0) {
+        return 0.0;
+    }
+    return static_cast<double>((*this)[PerfCounter::Instructions]) /
+           static_cast<double>((*this)[PerfCounter::Cycles]);
+}
+
+CounterValues CounterValues::delta(const CounterValues& start, const CounterValues& end) {
+    CounterValues result;
+    result.availableMask = end.availableMask & start.availableMask;
+    result.timeEnabled = end.timeEnabled > start.timeEnabled ? end.timeEnabled - start.timeEnabled : 0;
+    result.timeRunning = end.timeRunning > start.timeRunning ? end.timeRunning - start.timeRunning : 0;
+    // If the PMU was shared with other groups during the interval, extrapolate the
+    // interval's counts to its full enabled time. Scaling each snapshot separately
+    // would be wrong: the ratio changes between the two reads.
+    const double scale = (result.timeRunning > 0 && result.timeRunning < result.timeEnabled)
+        ? static_cast<double>(result.timeEnabled) / static_cast<double>(result.timeRunning) : 1.0;
+    for (std::size_t i = 0; i < kPerfCounterCount; ++i) {
+        if (((result.availableMask >> i) & 1u) && end.values[i] > start.values[i]) {
+            const std::uint64_t raw = end.values[i] - start.values[i];
+            result.values[i] = scale == 1.0 ? raw : static_cast<std::uint64_t>(static_cast<double>(raw) * scale);
+        }
+    }
+    return result;
+}
+
+#ifdef __linux__
+
+namespace {
+
+struct CounterConfig {
+    std::uint32_t type;
+    std::uint64_t config;
+};
+
+constexpr std::uint64_t cacheEvent(std::uint64_t cache, std::uint64_t op, std::uint64_t result) {
+    return cache | (op << 8) | (result << 16);
+}
+
+// Indexed by PerfCounter.
+constexpr std::array<CounterConfig, kPerfCounterCount> kCounterConfigs = {{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HW_CACHE, cacheEvent(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {PERF_TYPE_HW_CACHE, cacheEvent(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES},
+}};
+
+int openCounter(const CounterConfig& counter, int groupFd, bool excludeKernel) {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = counter.type;
+    attr.config = counter.config;
+    attr.exclude_kernel = excludeKernel ? 1 : 0;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    // pid = 0, cpu = -1: the calling thread, on whatever CPU it runs.
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+}
+
+} // namespace
+
+PerfCounterGroup::PerfCounterGroup() : m_leaderFd(-1), m_opened(0), m_availableMask(0) {
+    m_fds.fill(-1);
+    m_order.fill(0);
+
+    for (std::size_t i = 0; i < kPerfCounterCount; ++i) {
+        const bool isSoftware = kCounterConfigs[i].type == PERF_TYPE_SOFTWARE;
+        // Context switches happen in the kernel; try to count them there first,
+        // hardware counters are restricted to user space (allowed with perf_event_paranoid <= 2).
+        int fd = openCounter(kCounterConfigs[i], m_leaderFd, !isSoftware);
+        if (fd < 0 && isSoftware) {
+            fd = openCounter(kCounterConfigs[i], m_leaderFd, true);
+        }
+        if (fd < 0) {
+            if (!m_error.empty()) {
+                m_error += ", ";
+            }
+            m_error += std::string(perfCounterName(static_cast<PerfCounter>(i))) + ": " + std::strerror(errno);
+            continue;
+        }
+        if (m_leaderFd < 0) {
+            m_leaderFd = fd;
+        }
+        m_fds[i] = fd;
+        m_order[m_opened++] = i;
+        m_availableMask |= 1u << i;
+    }
+}
+
+PerfCounterGroup::~PerfCounterGroup() {
+    for (int fd : m_fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+CounterValues PerfCounterGroup::read() const {
+    CounterValues result;
+    if (!available()) {
+        return result;
+    }
+
+    // Layout for PERF_FORMAT_GROUP with both time fields: nr, time_enabled, time_running, values[nr]
+    std::array<std::uint64_t, 3 + kPerfCounterCount> buffer{};
+    const ssize_t bytes = ::read(m_leaderFd, buffer.data(), sizeof(buffer));
+    if (bytes < static_cast<ssize_t>(3 * sizeof(std::uint64_t))) {
+        return result;
+    }
+
+    // Raw values: multiplexing is corrected per interval in CounterValues::delta().
+    const std::uint64_t count = buffer[0];
+    result.timeEnabled = buffer[1];
+    result.timeRunning = buffer[2];
+    for (std::size_t n = 0; n < count && n < m_opened; ++n) {
+        result.values[m_order[n]] = buffer[3 + n];
+    }
+    result.availableMask = m_availableMask;
+    return result;
+}
+
+#else
+
+PerfCounterGroup::PerfCounterGroup()
+    : m_leaderFd(-1), m_opened(0), m_availableMask(0), m_error("perf_event_open requires Linux") {
+    m_fds.fill(-1);
+    m_order.fill(0);
+}
+
+PerfCounterGroup::~PerfCounterGroup() = default;
+
+CounterValues PerfCounterGroup::read() const {
+    return CounterValues{};
+}
+
+#endif // __linux__
+
+PerfCounterGroup& PerfCounterGroup::forCurrentThread() {
+    thread_local std::unique_ptr<PerfCounterGroup> group = std::make_unique<PerfCounterGroup>();
+    return *group;
+}
@@ -0,0 +1,98 @@
+#ifndef BENCHMARK_PERF_COUNTERS_H
+#define BENCHMARK_PERF_COUNTERS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Counters captured around a measured region.
+ * The order is the order of the values in CounterValues::values.
+ */
+enum class PerfCounter : std::size_t {
+    Instructions,
+    Cycles,
+    L1DMisses,
+    LLCMisses,
+    BranchMisses,
+    ContextSwitches,
+    Count
+};
+
+constexpr std::size_t kPerfCounterCount = static_cast<std::size_t>(PerfCounter::Count);
+
+const char* perfCounterName(PerfCounter counter);
+
+/**
+ * @struct CounterValues
+ * @brief Fixed-size snapshot (or delta) of all counters. Trivially copyable.
+ *
+ * `availableMask` has bit N set when counter N could be opened; other values are 0.
+ * A snapshot holds the raw cumulative counts and the group's enabled/running times;
+ * a delta holds counts extrapolated to the enabled time of the interval.
+ */
+struct CounterValues {
+    std::array<std::uint64_t, kPerfCounterCount> values{};
+    std::uint32_t availableMask = 0;
+    std::uint64_t timeEnabled = 0;  // ns the group was enabled
+    std::uint64_t timeRunning = 0;  // ns it was actually on the PMU (less when multiplexed)
+
+    bool has(PerfCounter counter) const {
+        return (availableMask >> static_cast<std::size_t>(counter)) & 1u;
+    }
+    std::uint64_t operator[](PerfCounter counter) const {
+        return values[static_cast<std::size_t>(counter)];
+    }
+    bool any() const { return availableMask != 0; }
+
+    // Instructions per cycle, or 0 if either counter is missing.
+    double ipc() const;
+
+    // Per-counter `end - start` of two raw snapshots, scaled once by
+    // (enabled time / running time) of the interval if the group was multiplexed.
+    // Counts that went backwards are clamped to 0.
+    static CounterValues delta(const CounterValues& start, const CounterValues& end);
+};
+
+/**
+ * @class PerfCounterGroup
+ * @brief perf_event_open counter group for the calling thread (user space only).
+ *
+ * All counters are opened as one group so the kernel schedules them together
+ * and a single read() returns a consistent snapshot of all of them.
+ * Counters that the CPU, the hypervisor or perf_event_paranoid do not allow are
+ * skipped; if none can be opened the group is unavailable and callers fall back
+ * to time-only measurements.
+ *
+ * A group counts events of the thread that created it, so it must be read on that thread.
+ */
+class PerfCounterGroup {
+public:
+    PerfCounterGroup();
+    ~PerfCounterGroup();
+
+    PerfCounterGroup(const PerfCounterGroup&) = delete;
+    PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+
+    bool available() const { return m_leaderFd >= 0; }
+
+    // Why the group or some counters are unavailable (empty if everything opened).
+    const std::string& error() const { return m_error; }
+
+    // Raw cumulative counter values and times; pass two of them to CounterValues::delta().
+    CounterValues read() const;
+
+    // Lazily opened group of the calling thread, shared by all scopes on that thread.
+    static PerfCounterGroup& forCurrentThread();
+
+private:
+    int m_leaderFd;
+    std::array<int, kPerfCounterCount> m_fds;
+    std::array<std::size_t, kPerfCounterCount> m_order;  // counter index of the N-th group member
+    std::size_t m_opened;
+    std::uint32_t m_availableMask;
+    std::string m_error;
+};
+
+#endif // BENCHMARK_PERF_COUNTERS_H
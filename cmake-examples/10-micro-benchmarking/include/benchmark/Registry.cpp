@@ -0,0 +1,336 @@
+#include "benchmark/Registry.h"
+#include "benchmark/ResultStore.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+using ParamPoint = std::vector<std::pair<std::string, std::int64_t>>;
+
+// Registered axes with the command-line overrides applied.
+std::vector<BenchmarkParam> effectiveParams(const BenchmarkCase& benchmarkCase, const RegistryOptions& options) {
+    std::vector<BenchmarkParam> params = benchmarkCase.params();
+    for (BenchmarkParam& param : params) {
+        for (const BenchmarkParam& override : options.overrides) {
+            if (override.name == param.name) {
+                param.values = override.values;
+            }
+        }
+    }
+    return params;
+}
+
+std::vector<ParamPoint> cartesianProduct(const std::vector<BenchmarkParam>& params) {
+    std::vector<ParamPoint> points(1);
+    for (const BenchmarkParam& param : params) {
+        std::vector<ParamPoint> next;
+        next.reserve(points.size() * param.values.size());
+        for (const ParamPoint& point : points) {
+            for (std::int64_t value : param.values) {
+                ParamPoint extended = point;
+                extended.emplace_back(param.name, value);
+                next.push_back(std::move(extended));
+            }
+        }
+        points = std::move(next);
+    }
+    return points;
+}
+
+template <typename Visitor>
+void forEachMatchingPoint(const std::vector<std::unique_ptr<BenchmarkCase>>& cases,
+                          const RegistryOptions& options, Visitor&& visit) {
+    const std::regex filter(options.filter.empty() ? ".*" : options.filter);
+    for (const auto& benchmarkCase : cases) {
+        for (const ParamPoint& point : cartesianProduct(effectiveParams(*benchmarkCase, options))) {
+            const std::string name = benchmarkPointName(benchmarkCase->name(), point);
+            if (std::regex_search(name, filter)) {
+                visit(*benchmarkCase, point, name);
+            }
+        }
+    }
+}
+
+// 1234567 -> "1.23M"
+std::string formatRate(double perSecond) {
+    if (perSecond <= 0.0) {
+        return "-";
+    }
+    static const char* const kSuffixes[] = {"", "k", "M", "G", "T"};
+    std::size_t suffix = 0;
+    while (perSecond >= 1000.0 && suffix + 1 < std::size(kSuffixes)) {
+        perSecond /= 1000.0;
+        ++suffix;
+    }
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << perSecond << kSuffixes[suffix];
+    return ss.str();
+}
+
+bool startsWith(const char* arg, const char* prefix, const char*& value) {
+    const std::size_t length = std::strlen(prefix);
+    if (std::strncmp(arg, prefix, length) != 0) {
+        return false;
+    }
+    value = arg + length;
+    return true;
+}
+
+// "orders=1000,1000000"
+BenchmarkParam parseOverride(const std::string& text) {
+    const std::size_t equals = text.find('=');
+    if (equals == std::string::npos || equals == 0) {
+        throw std::invalid_argument("expected --param=<name>=<v1>,<v2>,... got '" + text + "'");
+    }
+    BenchmarkParam param{text.substr(0, equals), {}};
+    std::stringstream values(text.substr(equals + 1));
+    std::string value;
+    while (std::getline(values, value, ',')) {
+        param.values.push_back(std::stoll(value));
+    }
+    if (param.values.empty()) {
+        throw std::invalid_argument("no values for parameter '" + param.name + "'");
+    }
+    return param;
+}
+
+void printHeader() {
+    std::cout << std::left << std::setw(44) << "Benchmark" << std::right
+              << std::setw(16) << "Median ns"
+              << std::setw(12) << "±95%"
+              << std::setw(12) << "Iterations"
+              << std::setw(12) << "items/s"
+              << std::setw(12) << "bytes/s" << "\n"
+              << std::string(108, '-') << "\n";
+}
+
+void printRow(const std::string& label, const BenchmarkStats& stats, double itemsPerSecond, double bytesPerSecond) {
+    const double relativeCi = stats.mean > 0.0 ? 100.0 * stats.ciHalfWidth / stats.mean : 0.0;
+    std::stringstream ci;
+    ci << std::fixed << std::setprecision(1) << relativeCi << "%" << (stats.converged ? "" : "*");
+    std::cout << std::left << std::setw(44) << label << std::right
+              << std::fixed << std::setprecision(1)
+              << std::setw(16) << stats.median
+              << std::setw(12) << ci.str()
+              << std::setw(12) << stats.iterations
+              << std::setw(12) << formatRate(itemsPerSecond)
+              << std::setw(12) << formatRate(bytesPerSecond) << "\n";
+}
+
+// Median over the repetitions of one point, reported when --repetitions > 1.
+void printRepetitionSummary(const std::vector<BenchmarkResult>& repetitions) {
+    std::vector<double> medians;
+    for (const BenchmarkResult& result : repetitions) {
+        medians.push_back(result.stats.median);
+    }
+    BenchmarkStats summary = BenchmarkStats::fromSamples(medians);
+    summary.iterations = repetitions.size();
+    const BenchmarkResult& first = repetitions.front();
+    const double seconds = summary.median / 1e9;
+    printRow(first.name + "_median", summary,
+             seconds > 0.0 ? static_cast<double>(first.itemsPerIteration) / seconds : 0.0,
+             seconds > 0.0 ? static_cast<double>(first.bytesPerIteration) / seconds : 0.0);
+}
+
+} // namespace
+
+BenchmarkState::BenchmarkState(std::string name, std::vector<std::pair<std::string, std::int64_t>> params,
+                               RunnerConfig config)
+    : m_name(std::move(name)), m_params(std::move(params)), m_config(config) {}
+
+std::int64_t BenchmarkState::param(const std::string& name) const {
+    for (const auto& [paramName, value] : m_params) {
+        if (paramName == name) {
+            return value;
+        }
+    }
+    throw std::out_of_range("benchmark '" + m_name + "' has no parameter '" + name + "'");
+}
+
+BenchmarkCase::BenchmarkCase(std::string name, BenchmarkFunction function)
+    : m_name(std::move(name)), m_function(std::move(function)) {}
+
+BenchmarkCase& BenchmarkCase::range(const std::string& param, std::int64_t lo, std::int64_t hi,
+                                    std::int64_t multiplier) {
+    if (lo <= 0 || hi < lo || multiplier < 2) {
+        throw std::invalid_argument("invalid range for parameter '" + param + "' of '" + m_name + "'");
+    }
+    std::vector<std::int64_t> sweep;
+    for (std::int64_t value = lo; value < hi; value *= multiplier) {
+        sweep.push_back(value);
+        if (value > hi / multiplier) {
+            break;  // value * multiplier would pass hi (and could overflow)
+        }
+    }
+    sweep.push_back(hi);
+    return values(param, std::move(sweep));
+}
+
+BenchmarkCase& BenchmarkCase::values(const std::string& param, std::initializer_list<std::int64_t> values) {
+    return this->values(param, std::vector<std::int64_t>(values));
+}
+
+BenchmarkCase& BenchmarkCase::values(const std::string& param, std::vector<std::int64_t> values) {
+    m_params.push_back(BenchmarkParam{param, std::move(values)});
+    return *this;
+}
+
+std::vector<std::vector<std::pair<std::string, std::int64_t>>> BenchmarkCase::points() const {
+    return cartesianProduct(m_params);
+}
+
+double BenchmarkResult::itemsPerSecond() const {
+    return stats.median > 0.0 ? static_cast<double>(itemsPerIteration) / (stats.median / 1e9) : 0.0;
+}
+
+double BenchmarkResult::bytesPerSecond() const {
+    return stats.median > 0.0 ? static_cast<double>(bytesPerIteration) / (stats.median / 1e9) : 0.0;
+}
+
+std::string benchmarkPointName(const std::string& caseName,
+                               const std::vector<std::pair<std::string, std::int64_t>>& params) {
+    std::string name = caseName;
+    for (const auto& [param, value] : params) {
+        name += "/" + param + ":" + std::to_string(value);
+    }
+    return name;
+}
+
+BenchmarkRegistry& BenchmarkRegistry::instance() {
+    static BenchmarkRegistry registry;
+    return registry;
+}
+
+BenchmarkCase& BenchmarkRegistry::add(std::string name, BenchmarkFunction function) {
+    m_cases.push_back(std::make_unique<BenchmarkCase>(std::move(name), std::move(function)));
+    return *m_cases.back();
+}
+
+std::vector<std::string> BenchmarkRegistry::list(const RegistryOptions& options) const {
+    std::vector<std::string> names;
+    forEachMatchingPoint(m_cases, options, [&](const BenchmarkCase&, const ParamPoint&, const std::string& name) {
+        names.push_back(name);
+    });
+    return names;
+}
+
+std::vector<BenchmarkResult> BenchmarkRegistry::run(const RegistryOptions& options,
+                                                    const std::function<void(const BenchmarkResult&)>& onResult) const {
+    std::vector<BenchmarkResult> results;
+    forEachMatchingPoint(m_cases, options, [&](const BenchmarkCase& benchmarkCase, const ParamPoint& point,
+                                               const std::string& name) {
+        for (std::size_t repetition = 0; repetition < options.repetitions; ++repetition) {
+            BenchmarkState state(name, point, options.runner);
+            benchmarkCase.function()(state);
+            if (!state.hasRun()) {
+                continue;   // the function decided to skip this point
+            }
+
+            BenchmarkResult result;
+            result.caseName = benchmarkCase.name();
+            result.name = name;
+            result.params = point;
+            result.repetition = repetition;
+            result.itemsPerIteration = state.itemsPerIteration();
+            result.bytesPerIteration = state.bytesPerIteration();
+            result.stats = state.stats();
+            if (onResult) {
+                onResult(result);
+            }
+            results.push_back(std::move(result));
+        }
+    });
+    return results;
+}
+
+int runBenchmarksFromCommandLine(int argc, char* argv[]) {
+    RegistryOptions options;
+    options.runner.warmupIterations = 2;
+    options.runner.adaptive = true;
+    options.runner.minIterations = 5;
+    options.runner.maxIterations = 100000;
+    options.runner.targetRelativeCi = 0.02;
+    options.runner.maxTime = std::chrono::seconds(2);
+    bool listOnly = false;
+    std::string jsonPath;
+    std::string csvPath;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const char* value = nullptr;
+            if (std::strcmp(argv[i], "--list") == 0) {
+                listOnly = true;
+            } else if (startsWith(argv[i], "--filter=", value)) {
+                options.filter = value;
+            } else if (startsWith(argv[i], "--repetitions=", value)) {
+                options.repetitions = std::max<std::size_t>(1, std::stoul(value));
+            } else if (startsWith(argv[i], "--param=", value)) {
+                options.overrides.push_back(parseOverride(value));
+            } else if (startsWith(argv[i], "--max-time=", value)) {
+                options.runner.maxTime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::duration<double>(std::stod(value)));
+            } else if (startsWith(argv[i], "--target-ci=", value)) {
+                options.runner.targetRelativeCi = std::stod(value);
+            } else if (startsWith(argv[i], "--json=", value)) {
+                jsonPath = value;
+            } else if (startsWith(argv[i], "--csv=", value)) {
+                csvPath = value;
+            } else {
+                std::cerr << "Unknown option: " << argv[i] << "\n"
+                          << "Usage: " << argv[0] << " [--list] [--filter=<regex>] [--repetitions=<n>]"
+                          << " [--param=<name>=<v1>,<v2>...] [--max-time=<seconds>] [--target-ci=<fraction>]"
+                          << " [--json=<file>] [--csv=<file>]\n";
+                return 2;
+            }
+        }
+
+        const BenchmarkRegistry& registry = BenchmarkRegistry::instance();
+        if (listOnly) {
+            for (const std::string& name : registry.list(options)) {
+                std::cout << name << "\n";
+            }
+            return 0;
+        }
+
+        printHeader();
+        std::vector<BenchmarkResult> repetitions;
+        const std::vector<BenchmarkResult> results = registry.run(options, [&](const BenchmarkResult& result) {
+            const std::string label = options.repetitions > 1
+                ? result.name + "/rep:" + std::to_string(result.repetition) : result.name;
+            printRow(label, result.stats, result.itemsPerSecond(), result.bytesPerSecond());
+
+            repetitions.push_back(result);
+            if (options.repetitions > 1 && result.repetition + 1 == options.repetitions) {
+                printRepetitionSummary(repetitions);
+            }
+            if (result.repetition + 1 == options.repetitions) {
+                repetitions.clear();
+            }
+        });
+        std::cout << "(* = adaptive run stopped before reaching the target precision)\n";
+
+        const HostInfo host = HostInfo::collect();
+        if (!jsonPath.empty()) {
+            std::ofstream json(jsonPath);
+            writeResultsJson(json, host, results);
+            std::cout << "Results written to " << jsonPath << "\n";
+        }
+        if (!csvPath.empty()) {
+            std::ofstream csv(csvPath);
+            writeResultsCsv(csv, host, results);
+            std::cout << "Results written to " << csvPath << "\n";
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,195 @@
+#ifndef BENCHMARK_REGISTRY_H
+#define BENCHMARK_REGISTRY_H
+
+#include "benchmark/BenchmarkRunner.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct BenchmarkParam
+ * @brief One named parameter axis of a registered benchmark, e.g. "orders" = 1k..10M.
+ */
+struct BenchmarkParam {
+    std::string name;
+    std::vector<std::int64_t> values;
+};
+
+/**
+ * @class BenchmarkState
+ * @brief Handed to a registered benchmark function for one parameter point.
+ *
+ * The function reads its parameters, does its setup (untimed), declares how many
+ * items/bytes one iteration processes and calls run() with the measured callable:
+ *
+ *   void riskSoA(BenchmarkState& state) {
+ *       OrderBatch batch = makeBatch(state.param("orders"));
+ *       state.setItemsPerIteration(batch.size());
+ *       state.run([&] { return calculatePortfolioRisk(batch); });
+ *   }
+ */
+class BenchmarkState {
+public:
+    BenchmarkState(std::string name, std::vector<std::pair<std::string, std::int64_t>> params,
+                   RunnerConfig config);
+
+    // Value of the named parameter at this point; throws std::out_of_range if not registered.
+    std::int64_t param(const std::string& name) const;
+    const std::vector<std::pair<std::string, std::int64_t>>& params() const { return m_params; }
+
+    // Work done by one call of the measured callable, used for items/s and bytes/s.
+    void setItemsPerIteration(std::uint64_t items) { m_itemsPerIteration = items; }
+    void setBytesPerIteration(std::uint64_t bytes) { m_bytesPerIteration = bytes; }
+    std::uint64_t itemsPerIteration() const { return m_itemsPerIteration; }
+    std::uint64_t bytesPerIteration() const { return m_bytesPerIteration; }
+
+    template <typename ClockPolicy = ChronoClock, typename Func>
+    void run(Func&& func) {
+        BenchmarkRunner runner(m_name, m_config);
+        m_stats = runner.run<ClockPolicy>(std::forward<Func>(func));
+        m_hasRun = true;
+    }
+
+    bool hasRun() const { return m_hasRun; }
+    const BenchmarkStats& stats() const { return m_stats; }
+
+    // "name/param:value/..."
+    const std::string& name() const { return m_name; }
+
+private:
+    std::string m_name;
+    std::vector<std::pair<std::string, std::int64_t>> m_params;
+    RunnerConfig m_config;
+    std::uint64_t m_itemsPerIteration = 0;
+    std::uint64_t m_bytesPerIteration = 0;
+    BenchmarkStats m_stats;
+    bool m_hasRun = false;
+};
+
+using BenchmarkFunction = std::function<void(BenchmarkState&)>;
+
+/**
+ * @class BenchmarkCase
+ * @brief A registered benchmark function and its parameter axes.
+ *
+ * Axes are combined as a cartesian product; each combination is one parameter point.
+ */
+class BenchmarkCase {
+public:
+    BenchmarkCase(std::string name, BenchmarkFunction function);
+
+    // Geometric range lo, lo*multiplier, ... up to and including hi.
+    BenchmarkCase& range(const std::string& param, std::int64_t lo, std::int64_t hi, std::int64_t multiplier = 10);
+    // Explicit list of values.
+    BenchmarkCase& values(const std::string& param, std::initializer_list<std::int64_t> values);
+    BenchmarkCase& values(const std::string& param, std::vector<std::int64_t> values);
+
+    const std::string& name() const { return m_name; }
+    const std::vector<BenchmarkParam>& params() const { return m_params; }
+    const BenchmarkFunction& function() const { return m_function; }
+
+    // All parameter points in sweep order (the last axis varies fastest).
+    std::vector<std::vector<std::pair<std::string, std::int64_t>>> points() const;
+
+private:
+    std::string m_name;
+    BenchmarkFunction m_function;
+    std::vector<BenchmarkParam> m_params;
+};
+
+/**
+ * @struct BenchmarkResult
+ * @brief Outcome of one repetition of one parameter point.
+ */
+struct BenchmarkResult {
+    std::string caseName;
+    std::string name;                                         // with parameters
+    std::vector<std::pair<std::string, std::int64_t>> params;
+    std::size_t repetition = 0;
+    std::uint64_t itemsPerIteration = 0;
+    std::uint64_t bytesPerIteration = 0;
+    BenchmarkStats stats;
+
+    // Throughput at the median iteration time, 0 if not declared.
+    double itemsPerSecond() const;
+    double bytesPerSecond() const;
+};
+
+/**
+ * @struct RegistryOptions
+ * @brief Selection and sweep options of BenchmarkRegistry::run().
+ */
+struct RegistryOptions {
+    std::string filter;                  // ECMAScript regex matched against "name/param:value"
+    std::size_t repetitions = 1;
+    RunnerConfig runner;
+    // Replaces the registered values of a parameter, e.g. {"orders", {1000, 1000000}}
+    std::vector<BenchmarkParam> overrides;
+};
+
+/**
+ * @class BenchmarkRegistry
+ * @brief Process-wide list of benchmarks registered with BENCHMARK_REGISTER.
+ *
+ * Registration happens during static initialization, so the registering
+ * translation units must be linked into the executable directly (a static
+ * library would let the linker drop them).
+ */
+class BenchmarkRegistry {
+public:
+    static BenchmarkRegistry& instance();
+
+    BenchmarkCase& add(std::string name, BenchmarkFunction function);
+    const std::vector<std::unique_ptr<BenchmarkCase>>& cases() const { return m_cases; }
+
+    // Names with parameters of all points that match the options, in run order.
+    std::vector<std::string> list(const RegistryOptions& options) const;
+
+    // Runs every matching point `repetitions` times; `onResult` sees each result as it completes.
+    std::vector<BenchmarkResult> run(const RegistryOptions& options,
+                                     const std::function<void(const BenchmarkResult&)>& onResult = {}) const;
+
+    BenchmarkRegistry(const BenchmarkRegistry&) = delete;
+    BenchmarkRegistry& operator=(const BenchmarkRegistry&) = delete;
+
+private:
+    BenchmarkRegistry() = default;
+
+    std::vector<std::unique_ptr<BenchmarkCase>> m_cases;
+};
+
+// Formats a point as "case/param:value/param:value".
+std::string benchmarkPointName(const std::string& caseName,
+                               const std::vector<std::pair<std::string, std::int64_t>>& params);
+
+/**
+ * Command-line front end used by benchmark_runner:
+ *   --list                      print the matching points and exit
+ *   --filter=<regex>            run only points whose name matches
+ *   --repetitions=<n>           run each point n times
+ *   --param=<name>=<v1>,<v2>    sweep these values instead of the registered ones
+ *   --max-time=<seconds>        adaptive time limit per point (default 2)
+ *   --target-ci=<fraction>      adaptive precision target (default 0.02)
+ *   --json=<file>, --csv=<file> also write the results (see ResultStore.h)
+ * Returns the process exit code.
+ */
+int runBenchmarksFromCommandLine(int argc, char* argv[]);
+
+#ifndef BENCHMARK_CONCAT
+    #define BENCHMARK_CONCAT_IMPL(a, b) a##b
+    #define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_IMPL(a, b)
+#endif
+
+// Registers `function` (a void(BenchmarkState&)) under its own name.
+// Returns the BenchmarkCase so axes can be chained:
+//   BENCHMARK_REGISTER(riskSoA).range("orders", 1000, 10'000'000);
+#define BENCHMARK_REGISTER(function) \
+    [[maybe_unused]] static BenchmarkCase& BENCHMARK_CONCAT(g_benchmarkCase_, __LINE__) = \
+        BenchmarkRegistry::instance().add(#function, function)
+
+#endif // BENCHMARK_REGISTRY_H
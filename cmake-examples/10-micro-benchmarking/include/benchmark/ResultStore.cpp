@@ -0,0 +1,413 @@
+#include "benchmark/ResultStore.h"
+#include "benchmark/JsonDetail.h"
+#include <cctype>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#ifdef __unix__
+    #include <sys/utsname.h>
+    #include <unistd.h>
+#endif
+
+// Set by CMake for this file; fallbacks keep the library buildable on its own.
+#ifndef BENCHMARK_BUILD_TYPE
+    #define BENCHMARK_BUILD_TYPE "unknown"
+#endif
+#ifndef BENCHMARK_BUILD_FLAGS
+    #define BENCHMARK_BUILD_FLAGS "unknown"
+#endif
+
+namespace {
+
+std::string compilerDescription() {
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + std::to_string(_MSC_VER);
+#else
+    return "unknown";
+#endif
+}
+
+std::string readCpuModel() {
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.rfind("model name", 0) == 0) {
+            const std::size_t colon = line.find(':');
+            if (colon != std::string::npos) {
+                return line.substr(line.find_first_not_of(' ', colon + 1));
+            }
+        }
+    }
+    return "unknown";
+}
+
+// --- Writing ---
+
+// CSV field, quoted when it contains a separator, quote or newline.
+std::string csvField(const std::string& text) {
+    if (text.find_first_of(",\"\n") == std::string::npos) {
+        return text;
+    }
+    std::string quoted = "\"";
+    for (char c : text) {
+        quoted += c;
+        if (c == '"') {
+            quoted += '"';
+        }
+    }
+    return quoted + "\"";
+}
+
+// --- Reading: a minimal JSON parser, enough for the files written above ---
+
+struct JsonValue {
+    enum class Type { Null, Bool, Number, String, Array, Object };
+    Type type = Type::Null;
+    bool boolean = false;
+    double number = 0.0;
+    std::string string;
+    std::vector<JsonValue> array;
+    std::vector<std::pair<std::string, JsonValue>> object;
+
+    const JsonValue* find(const std::string& key) const {
+        for (const auto& [name, value] : object) {
+            if (name == key) {
+                return &value;
+            }
+        }
+        return nullptr;
+    }
+    const JsonValue& at(const std::string& key) const {
+        const JsonValue* value = find(key);
+        if (value == nullptr) {
+            throw std::runtime_error("missing JSON field '" + key + "'");
+        }
+        return *value;
+    }
+    std::string stringOr(const std::string& key, const std::string& fallback) const {
+        const JsonValue* value = find(key);
+        return value != nullptr && value->type == Type::String ? value->string : fallback;
+    }
+    double numberOr(const std::string& key, double fallback) const {
+        const JsonValue* value = find(key);
+        return value != nullptr && value->type == Type::Number ? value->number : fallback;
+    }
+};
+
+class JsonParser {
+public:
+    explicit JsonParser(std::string text) : m_text(std::move(text)) {}
+
+    JsonValue parseDocument() {
+        JsonValue value = parseValue();
+        skipWhitespace();
+        if (m_pos != m_text.size()) {
+            fail("trailing characters");
+        }
+        return value;
+    }
+
+private:
+    [[noreturn]] void fail(const std::string& what) const {
+        throw std::runtime_error("JSON parse error at offset " + std::to_string(m_pos) + ": " + what);
+    }
+
+    void skipWhitespace() {
+        while (m_pos < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_pos]))) {
+            ++m_pos;
+        }
+    }
+
+    bool consume(const char* literal) {
+        const std::size_t length = std::strlen(literal);
+        if (m_text.compare(m_pos, length, literal) == 0) {
+            m_pos += length;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c) {
+        skipWhitespace();
+        if (m_pos >= m_text.size() || m_text[m_pos] != c) {
+            fail(std::string("expected '") + c + "'");
+        }
+        ++m_pos;
+    }
+
+    JsonValue parseValue() {
+        skipWhitespace();
+        if (m_pos >= m_text.size()) {
+            fail("unexpected end of input");
+        }
+        JsonValue value;
+        const char c = m_text[m_pos];
+        if (c == '{') {
+            value.type = JsonValue::Type::Object;
+            ++m_pos;
+            skipWhitespace();
+            if (m_pos < m_text.size() && m_text[m_pos] == '}') {
+                ++m_pos;
+                return value;
+            }
+            do {
+                skipWhitespace();
+                std::string key = parseString();
+                expect(':');
+                value.object.emplace_back(std::move(key), parseValue());
+                skipWhitespace();
+            } while (m_pos < m_text.size() && m_text[m_pos] == ',' && ++m_pos);
+            expect('}');
+        } else if (c == '[') {
+            value.type = JsonValue::Type::Array;
+            ++m_pos;
+            skipWhitespace();
+            if (m_pos < m_text.size() && m_text[m_pos] == ']') {
+                ++m_pos;
+                return value;
+            }
+            do {
+                value.array.push_back(parseValue());
+                skipWhitespace();
+            } while (m_pos < m_text.size() && m_text[m_pos] == ',' && ++m_pos);
+            expect(']');
+        } else if (c == '"') {
+            value.type = JsonValue::Type::String;
+            value.string = parseString();
+        } else if (consume("true")) {
+            value.type = JsonValue::Type::Bool;
+            value.boolean = true;
+        } else if (consume("false")) {
+            value.type = JsonValue::Type::Bool;
+        } else if (consume("null")) {
+            value.type = JsonValue::Type::Null;
+        } else {
+            value.type = JsonValue::Type::Number;
+            const char* begin = m_text.c_str() + m_pos;
+            char* end = nullptr;
+            value.number = std::strtod(begin, &end);
+            if (end == begin) {
+                fail("invalid value");
+            }
+            m_pos += static_cast<std::size_t>(end - begin);
+        }
+        return value;
+    }
+
+    std::string parseString() {
+        if (m_pos >= m_text.size() || m_text[m_pos] != '"') {
+            fail("expected string");
+        }
+        ++m_pos;
+        std::string result;
+        while (m_pos < m_text.size() && m_text[m_pos] != '"') {
+            char c = m_text[m_pos++];
+            if (c == '\\' && m_pos < m_text.size()) {
+                const char escaped = m_text[m_pos++];
+                switch (escaped) {
+                    case 'n': c = '\n'; break;
+                    case 't': c = '\t'; break;
+                    case 'r': c = '\r'; break;
+                    case 'b': c = '\b'; break;
+                    case 'f': c = '\f'; break;
+                    case 'u':
+                        // Only the control characters written by writeJsonString() are expected.
+                        if (m_pos + 4 > m_text.size()) {
+                            fail("truncated \\u escape");
+                        }
+                        c = static_cast<char>(std::stoi(m_text.substr(m_pos, 4), nullptr, 16));
+                        m_pos += 4;
+                        break;
+                    default: c = escaped;
+                }
+            }
+            result += c;
+        }
+        if (m_pos >= m_text.size()) {
+            fail("unterminated string");
+        }
+        ++m_pos;
+        return result;
+    }
+
+    std::string m_text;
+    std::size_t m_pos = 0;
+};
+
+// BenchmarkStats::clock points to a static string; map stored names back to the clock policies.
+const char* clockName(const std::string& name) {
+    if (name == TscClock::name) {
+        return TscClock::name;
+    }
+    return ChronoClock::name;
+}
+
+} // namespace
+
+HostInfo HostInfo::collect() {
+    HostInfo info;
+    info.cpuModel = readCpuModel();
+    info.logicalCpus = std::thread::hardware_concurrency();
+    info.compiler = compilerDescription();
+    info.buildType = BENCHMARK_BUILD_TYPE;
+    info.buildFlags = BENCHMARK_BUILD_FLAGS;
+
+#ifdef __unix__
+    char hostname[256] = {};
+    if (gethostname(hostname, sizeof(hostname) - 1) == 0) {
+        info.hostname = hostname;
+    }
+    utsname system{};
+    if (uname(&system) == 0) {
+        info.os = std::string(system.sysname) + " " + system.release;
+    }
+#endif
+
+    const std::time_t now = std::time(nullptr);
+    std::tm utc{};
+#ifdef _WIN32
+    gmtime_s(&utc, &now);
+#else
+    gmtime_r(&now, &utc);
+#endif
+    char timestamp[32];
+    std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", &utc);
+    info.timestamp = timestamp;
+    return info;
+}
+
+void writeResultsJson(std::ostream& out, const HostInfo& host, const std::vector<BenchmarkResult>& results) {
+    // Enough digits to read back every sample exactly.
+    out << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+    out << "{\n  \"context\": {";
+    const std::pair<const char*, const std::string*> fields[] = {
+        {"host", &host.hostname}, {"cpu", &host.cpuModel}, {"os", &host.os},
+        {"compiler", &host.compiler}, {"build_type", &host.buildType},
+        {"build_flags", &host.buildFlags}, {"timestamp", &host.timestamp},
+    };
+    for (const auto& [key, value] : fields) {
+        out << "\n    \"" << key << "\": ";
+        benchmark_detail::writeJsonString(out, *value);
+        out << ",";
+    }
+    out << "\n    \"logical_cpus\": " << host.logicalCpus << "\n  },\n  \"benchmarks\": [";
+
+    bool first = true;
+    for (const BenchmarkResult& result : results) {
+        const BenchmarkStats& stats = result.stats;
+        out << (first ? "" : ",") << "\n    {\"name\": ";
+        first = false;
+        benchmark_detail::writeJsonString(out, result.name);
+        out << ", \"case\": ";
+        benchmark_detail::writeJsonString(out, result.caseName);
+        out << ", \"params\": {";
+        for (std::size_t i = 0; i < result.params.size(); ++i) {
+            out << (i == 0 ? "" : ", ");
+            benchmark_detail::writeJsonString(out, result.params[i].first);
+            out << ": " << result.params[i].second;
+        }
+        out << "}, \"repetition\": " << result.repetition
+            << ", \"clock\": \"" << stats.clock << "\""
+            << ", \"iterations\": " << stats.iterations
+            << ", \"converged\": " << (stats.converged ? "true" : "false")
+            << ", \"items_per_iteration\": " << result.itemsPerIteration
+            << ", \"bytes_per_iteration\": " << result.bytesPerIteration
+            << ",\n     \"min_ns\": " << stats.min
+            << ", \"median_ns\": " << stats.median
+            << ", \"mean_ns\": " << stats.mean
+            << ", \"stddev_ns\": " << stats.stddev
+            << ", \"p90_ns\": " << stats.p90
+            << ", \"p99_ns\": " << stats.p99
+            << ", \"p999_ns\": " << stats.p999
+            << ", \"max_ns\": " << stats.max
+            << ", \"ci_half_width_ns\": " << stats.ciHalfWidth
+            << ", \"items_per_second\": " << result.itemsPerSecond()
+            << ", \"bytes_per_second\": " << result.bytesPerSecond()
+            << ",\n     \"samples_ns\": [";
+        for (std::size_t i = 0; i < stats.samples.size(); ++i) {
+            out << (i == 0 ? "" : ",") << stats.samples[i];
+        }
+        out << "]}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+void writeResultsCsv(std::ostream& out, const HostInfo& host, const std::vector<BenchmarkResult>& results) {
+    out << "# host: " << host.hostname << "\n"
+        << "# cpu: " << host.cpuModel << " (" << host.logicalCpus << " logical CPUs)\n"
+        << "# os: " << host.os << "\n"
+        << "# compiler: " << host.compiler << "\n"
+        << "# build: " << host.buildType << " " << host.buildFlags << "\n"
+        << "# timestamp: " << host.timestamp << "\n";
+    out << "name,case,params,repetition,clock,iterations,converged,min_ns,median_ns,mean_ns,stddev_ns,"
+           "p90_ns,p99_ns,p999_ns,max_ns,ci_half_width_ns,items_per_second,bytes_per_second\n";
+
+    out << std::setprecision(12);
+    for (const BenchmarkResult& result : results) {
+        const BenchmarkStats& stats = result.stats;
+        std::string params;
+        for (const auto& [name, value] : result.params) {
+            params += (params.empty() ? "" : ";") + name + "=" + std::to_string(value);
+        }
+        out << csvField(result.name) << ',' << csvField(result.caseName) << ',' << csvField(params) << ','
+            << result.repetition << ',' << stats.clock << ',' << stats.iterations << ','
+            << (stats.converged ? 1 : 0) << ','
+            << stats.min << ',' << stats.median << ',' << stats.mean << ',' << stats.stddev << ','
+            << stats.p90 << ',' << stats.p99 << ',' << stats.p999 << ',' << stats.max << ','
+            << stats.ciHalfWidth << ',' << result.itemsPerSecond() << ',' << result.bytesPerSecond() << '\n';
+    }
+}
+
+ResultFile readResultsJson(std::istream& in) {
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    const JsonValue document = JsonParser(buffer.str()).parseDocument();
+
+    ResultFile file;
+    if (const JsonValue* context = document.find("context")) {
+        file.host.hostname = context->stringOr("host", "");
+        file.host.cpuModel = context->stringOr("cpu", "");
+        file.host.os = context->stringOr("os", "");
+        file.host.compiler = context->stringOr("compiler", "");
+        file.host.buildType = context->stringOr("build_type", "");
+        file.host.buildFlags = context->stringOr("build_flags", "");
+        file.host.timestamp = context->stringOr("timestamp", "");
+        file.host.logicalCpus = static_cast<unsigned>(context->numberOr("logical_cpus", 0));
+    }
+
+    for (const JsonValue& entry : document.at("benchmarks").array) {
+        BenchmarkResult result;
+        result.name = entry.at("name").string;
+        result.caseName = entry.stringOr("case", result.name);
+        if (const JsonValue* params = entry.find("params")) {
+            for (const auto& [name, value] : params->object) {
+                result.params.emplace_back(name, static_cast<std::int64_t>(value.number));
+            }
+        }
+        result.repetition = static_cast<std::size_t>(entry.numberOr("repetition", 0));
+        result.itemsPerIteration = static_cast<std::uint64_t>(entry.numberOr("items_per_iteration", 0));
+        result.bytesPerIteration = static_cast<std::uint64_t>(entry.numberOr("bytes_per_iteration", 0));
+
+        std::vector<double> samples;
+        for (const JsonValue& sample : entry.at("samples_ns").array) {
+            samples.push_back(sample.number);
+        }
+        result.stats = BenchmarkStats::fromSamples(std::move(samples));
+        result.stats.clock = clockName(entry.stringOr("clock", ChronoClock::name));
+        const JsonValue* converged = entry.find("converged");
+        result.stats.converged = converged == nullptr || converged->boolean;
+        file.results.push_back(std::move(result));
+    }
+    return file;
+}
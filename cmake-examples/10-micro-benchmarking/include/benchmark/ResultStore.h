@@ -0,0 +1,52 @@
+#ifndef BENCHMARK_RESULT_STORE_H
+#define BENCHMARK_RESULT_STORE_H
+
+#include "benchmark/Registry.h"
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @struct HostInfo
+ * @brief Where and how a result file was produced.
+ *
+ * Two result files are only comparable when these match closely enough;
+ * benchmark_compare prints both so differences are visible.
+ */
+struct HostInfo {
+    std::string hostname;
+    std::string cpuModel;       // "model name" from /proc/cpuinfo
+    unsigned logicalCpus = 0;
+    std::string os;             // uname sysname + release
+    std::string compiler;
+    std::string buildType;      // CMAKE_BUILD_TYPE of the benchmark library
+    std::string buildFlags;     // compiler flags of that build type
+    std::string timestamp;      // UTC, ISO 8601
+
+    // Describes the current process.
+    static HostInfo collect();
+};
+
+/**
+ * @struct ResultFile
+ * @brief Contents of a JSON result file.
+ *
+ * Statistics are recomputed from the stored raw samples when reading,
+ * so the file stays the single source of truth.
+ */
+struct ResultFile {
+    HostInfo host;
+    std::vector<BenchmarkResult> results;
+};
+
+// JSON with the host context and, per result, the summary statistics and all raw samples.
+void writeResultsJson(std::ostream& out, const HostInfo& host, const std::vector<BenchmarkResult>& results);
+
+// One row per result (summary only), host context as leading '#' comment lines.
+void writeResultsCsv(std::ostream& out, const HostInfo& host, const std::vector<BenchmarkResult>& results);
+
+// Reads a file written by writeResultsJson(); throws std::runtime_error on malformed input.
+ResultFile readResultsJson(std::istream& in);
+
+#endif // BENCHMARK_RESULT_STORE_H
@@ -0,0 +1,207 @@
+#include "benchmark/SampleCollector.h"
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+thread_local SampleCollector::ThreadBuffer* SampleCollector::t_buffer = nullptr;
+// Owned jointly with the collector's registry, so samples written just before
+// a thread exits are still drained afterwards.
+thread_local std::shared_ptr<SampleCollector::ThreadBuffer> SampleCollector::t_bufferOwner;
+
+SampleCollector& SampleCollector::instance() {
+    static SampleCollector collector;
+    return collector;
+}
+
+SampleCollector::SampleCollector()
+    : m_droppedFromExitedThreads(0), m_running(true), m_reportAtExit(true) {
+    m_aggregator = std::thread(&SampleCollector::aggregatorLoop, this);
+}
+
+SampleCollector::~SampleCollector() {
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_running = false;
+    }
+    m_wake.notify_one();
+    if (m_aggregator.joinable()) {
+        m_aggregator.join();
+    }
+    if (m_reportAtExit) {
+        std::string summary = report();
+        if (!m_scopes.empty()) {
+            std::cout << summary << std::endl;
+        }
+    }
+}
+
+double ScopeStats::counterMean(PerfCounter counter) const {
+    const auto index = static_cast<std::size_t>(counter);
+    if (counterSamples == 0 || ((counterMask >> index) & 1u) == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(counterSums[index]) / static_cast<double>(counterSamples);
+}
+
+void SampleCollector::record(const Sample& sample) noexcept {
+    ThreadBuffer* buffer = t_buffer;
+    if (buffer == nullptr) {
+        buffer = registerThread();
+    }
+    if (!buffer->ring.push(sample)) {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+SampleCollector::ThreadBuffer* SampleCollector::registerThread() {
+    SampleCollector& self = instance();
+    auto buffer = std::make_shared<ThreadBuffer>();
+    {
+        std::lock_guard<std::mutex> lock(self.m_registryMutex);
+        self.m_buffers.push_back(buffer);
+    }
+    t_buffer = buffer.get();
+    t_bufferOwner = std::move(buffer);
+    return t_buffer;
+}
+
+void SampleCollector::aggregatorLoop() {
+    std::unique_lock<std::mutex> wakeLock(m_wakeMutex);
+    while (m_running) {
+        m_wake.wait_for(wakeLock, kDrainInterval, [this] { return !m_running; });
+        wakeLock.unlock();
+        {
+            std::lock_guard<std::mutex> lock(m_aggregateMutex);
+            drainAll();
+        }
+        wakeLock.lock();
+    }
+}
+
+void SampleCollector::drainAll() {
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(m_registryMutex);
+        buffers = m_buffers;
+    }
+
+    for (const auto& buffer : buffers) {
+        buffer->ring.drain([this](const Sample& sample) {
+            ScopeStats*& scope = m_byPointer[sample.name];
+            if (scope == nullptr) {
+                // The same literal may have different addresses in different
+                // translation units, so the statistics themselves are keyed by content.
+                scope = &m_scopes[sample.name];
+            }
+            scope->latency.record(sample.durationNs);
+            if (sample.counters.any()) {
+                for (std::size_t i = 0; i < kPerfCounterCount; ++i) {
+                    scope->counterSums[i] += sample.counters.values[i];
+                }
+                scope->counterMask |= sample.counters.availableMask;
+                ++scope->counterSamples;
+            }
+        });
+    }
+
+    // Forget buffers of threads that have exited and have nothing left to drain.
+    // Our local copy holds one reference and the registry another.
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+    for (auto it = m_buffers.begin(); it != m_buffers.end();) {
+        if (it->use_count() == 2 && (*it)->ring.empty()) {
+            m_droppedFromExitedThreads += (*it)->dropped.load(std::memory_order_relaxed);
+            it = m_buffers.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+std::map<std::string, ScopeStats> SampleCollector::scopes() {
+    std::lock_guard<std::mutex> lock(m_aggregateMutex);
+    drainAll();
+    return m_scopes;
+}
+
+void SampleCollector::reset() {
+    std::lock_guard<std::mutex> lock(m_aggregateMutex);
+    drainAll();
+    m_scopes.clear();
+    m_byPointer.clear();
+}
+
+std::uint64_t SampleCollector::droppedSamples() const {
+    std::uint64_t dropped = m_droppedFromExitedThreads.load();
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+    for (const auto& buffer : m_buffers) {
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+std::string SampleCollector::report() {
+    std::lock_guard<std::mutex> lock(m_aggregateMutex);
+    drainAll();
+
+    auto us = [](double ns) { return ns / 1000.0; };
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    ss << "--- Scoped Benchmarks (latency, µs) ---\n";
+    ss << std::left << std::setw(32) << "  Name" << std::right
+       << std::setw(10) << "Count"
+       << std::setw(12) << "Min"
+       << std::setw(12) << "p50"
+       << std::setw(12) << "p90"
+       << std::setw(12) << "p99"
+       << std::setw(12) << "p99.9"
+       << std::setw(12) << "Max"
+       << std::setw(12) << "Mean" << "\n";
+    for (const auto& [name, scope] : m_scopes) {
+        const LatencyHistogram& h = scope.latency;
+        ss << "  " << std::left << std::setw(30) << name << std::right
+           << std::setw(10) << h.count()
+           << std::setw(12) << us(static_cast<double>(h.min()))
+           << std::setw(12) << us(static_cast<double>(h.percentile(0.50)))
+           << std::setw(12) << us(static_cast<double>(h.percentile(0.90)))
+           << std::setw(12) << us(static_cast<double>(h.percentile(0.99)))
+           << std::setw(12) << us(static_cast<double>(h.percentile(0.999)))
+           << std::setw(12) << us(static_cast<double>(h.max()))
+           << std::setw(12) << us(h.mean()) << "\n";
+    }
+
+    // Hardware counters, averaged per call, for scopes that captured them.
+    bool counterHeader = false;
+    for (const auto& [name, scope] : m_scopes) {
+        if (scope.counterSamples == 0) {
+            continue;
+        }
+        if (!counterHeader) {
+            ss << "--- Hardware counters (per call) ---\n";
+            counterHeader = true;
+        }
+        ss << "  " << name << " (" << scope.counterSamples << " samples)\n";
+        for (std::size_t i = 0; i < kPerfCounterCount; ++i) {
+            const auto counter = static_cast<PerfCounter>(i);
+            ss << "    " << std::left << std::setw(18) << perfCounterName(counter) << std::right;
+            if ((scope.counterMask >> i) & 1u) {
+                ss << std::setprecision(1) << scope.counterMean(counter) << "\n";
+            } else {
+                ss << "n/a\n";
+            }
+        }
+        const double cycles = scope.counterMean(PerfCounter::Cycles);
+        if (cycles > 0.0) {
+            ss << "    " << std::left << std::setw(18) << "IPC" << std::right << std::setprecision(2)
+               << scope.counterMean(PerfCounter::Instructions) / cycles << "\n";
+        }
+        ss << std::setprecision(3);
+    }
+
+    const std::uint64_t dropped = droppedSamples();
+    if (dropped > 0) {
+        ss << "  Dropped samples (buffer full): " << dropped << "\n";
+    }
+    ss << "-------------------------------------";
+    return ss.str();
+}
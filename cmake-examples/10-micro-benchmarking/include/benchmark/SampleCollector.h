@@ -0,0 +1,119 @@
+#ifndef BENCHMARK_SAMPLE_COLLECTOR_H
+#define BENCHMARK_SAMPLE_COLLECTOR_H
+
+#include "benchmark/LatencyHistogram.h"
+#include "benchmark/PerfCounters.h"
+#include "benchmark/SpscRingBuffer.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @struct Sample
+ * @brief One measured scope. Fixed size, so recording never allocates.
+ *
+ * `name` must point to storage that outlives the collector (a string literal,
+ * which is what the benchmark(name) macro is used with).
+ */
+struct Sample {
+    const char* name;
+    std::uint64_t durationNs;
+    CounterValues counters;  // empty unless recorded by benchmark_counters(name)
+};
+
+/**
+ * @struct ScopeStats
+ * @brief Everything aggregated for one scope name.
+ */
+struct ScopeStats {
+    LatencyHistogram latency;
+    std::array<std::uint64_t, kPerfCounterCount> counterSums{};
+    std::uint64_t counterSamples = 0;   // samples that carried counters
+    std::uint32_t counterMask = 0;      // counters seen in those samples
+
+    // Average per call of one counter, 0 if never captured.
+    double counterMean(PerfCounter counter) const;
+};
+
+/**
+ * @class SampleCollector
+ * @brief Collects ScopedBenchmark samples without blocking the measured threads.
+ *
+ * Every thread writes into its own lock-free ring buffer; the hot path is a
+ * thread_local lookup and a store, with no locks, allocations or I/O.
+ * A background aggregator thread drains the buffers every few milliseconds and
+ * folds the samples into one LatencyHistogram per scope name (plus hardware
+ * counter totals for scopes measured with benchmark_counters).
+ * If a buffer is full the sample is dropped and counted, never waited for.
+ *
+ * The report is printed at exit by default; call report() to get it on demand.
+ */
+class SampleCollector {
+public:
+    static constexpr std::size_t kBufferCapacity = 16384;  // samples per thread (72 bytes each)
+    static constexpr std::chrono::milliseconds kDrainInterval{10};
+
+    static SampleCollector& instance();
+
+    // Hot path, called from ScopedBenchmark destructors on any thread.
+    static void record(const Sample& sample) noexcept;
+
+    // Drains all thread buffers now and returns the per-name summary.
+    std::string report();
+
+    // Drains all thread buffers now and returns a copy of the per-name statistics.
+    std::map<std::string, ScopeStats> scopes();
+
+    // Discards everything aggregated so far (buffers are drained first).
+    void reset();
+
+    std::uint64_t droppedSamples() const;
+
+    void setReportAtExit(bool enabled) { m_reportAtExit = enabled; }
+
+    SampleCollector(const SampleCollector&) = delete;
+    SampleCollector& operator=(const SampleCollector&) = delete;
+
+private:
+    struct ThreadBuffer {
+        SpscRingBuffer<Sample, kBufferCapacity> ring;
+        std::atomic<std::uint64_t> dropped{0};
+    };
+
+    SampleCollector();
+    ~SampleCollector();
+
+    // Slow path: first sample recorded by a thread.
+    static ThreadBuffer* registerThread();
+
+    // Fast-path pointer (trivially destructible, cheap TLS access) and the owning reference.
+    static thread_local ThreadBuffer* t_buffer;
+    static thread_local std::shared_ptr<ThreadBuffer> t_bufferOwner;
+
+    void aggregatorLoop();
+    void drainAll();  // caller holds m_aggregateMutex
+
+    mutable std::mutex m_registryMutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+
+    std::mutex m_aggregateMutex;
+    std::map<std::string, ScopeStats> m_scopes;
+    std::unordered_map<const char*, ScopeStats*> m_byPointer;  // avoids a string per sample
+    std::atomic<std::uint64_t> m_droppedFromExitedThreads;
+
+    std::atomic<bool> m_running;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+    std::thread m_aggregator;
+    bool m_reportAtExit;
+};
+
+#endif // BENCHMARK_SAMPLE_COLLECTOR_H
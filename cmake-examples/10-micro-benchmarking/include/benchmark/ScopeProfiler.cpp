@@ -0,0 +1,179 @@
+#include "benchmark/ScopeProfiler.h"
+#include "benchmark/JsonDetail.h"
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+thread_local ScopeProfiler::ThreadTree* ScopeProfiler::t_tree = nullptr;
+
+namespace {
+
+// Collapsed-stack frames are separated by ';', the count follows the last space.
+std::string collapsedFrame(const char* name) {
+    std::string frame(name);
+    std::replace(frame.begin(), frame.end(), ';', ':');
+    return frame;
+}
+
+void writeCollapsed(std::ostream& out, const CallNode& node, const std::string& prefix) {
+    const std::string path = prefix.empty() ? collapsedFrame(node.name)
+                                            : prefix + ";" + collapsedFrame(node.name);
+    if (node.exclusiveNs() > 0) {
+        out << path << ' ' << node.exclusiveNs() << '\n';
+    }
+    for (const auto& child : node.children) {
+        writeCollapsed(out, *child, path);
+    }
+}
+
+void writeTree(std::ostream& out, const CallNode& node, int depth) {
+    auto ms = [](std::uint64_t ns) { return static_cast<double>(ns) / 1e6; };
+    out << "  " << std::string(static_cast<std::size_t>(depth) * 2, ' ')
+        << std::left << std::setw(std::max(1, 36 - depth * 2)) << node.name << std::right
+        << std::setw(10) << node.calls
+        << std::setw(14) << ms(node.inclusiveNs)
+        << std::setw(14) << ms(node.exclusiveNs()) << '\n';
+    for (const auto& child : node.children) {
+        writeTree(out, *child, depth + 1);
+    }
+}
+
+} // namespace
+
+ScopeProfiler& ScopeProfiler::instance() {
+    static ScopeProfiler profiler;
+    return profiler;
+}
+
+ScopeProfiler::ThreadTree* ScopeProfiler::registerThread() {
+    ScopeProfiler& self = instance();
+    auto tree = std::make_shared<ThreadTree>();
+    {
+        std::lock_guard<std::mutex> lock(self.m_registryMutex);
+        tree->threadId = static_cast<std::uint32_t>(self.m_trees.size() + 1);
+        tree->eventLimit = self.m_traceEventLimit;
+        self.m_trees.push_back(tree);
+    }
+    // The whole limit up front: exit() must not allocate inside measured code.
+    tree->events.reserve(tree->eventLimit);
+    t_tree = tree.get();
+    return t_tree;
+}
+
+ScopeProfiler::ThreadTree& ScopeProfiler::localTree() {
+    ThreadTree* tree = t_tree;
+    return tree != nullptr ? *tree : *registerThread();
+}
+
+CallNode* ScopeProfiler::enter(const char* name) {
+    ThreadTree& tree = localTree();
+    CallNode* parent = tree.current;
+
+    // Few children per node in practice: a linear scan comparing pointers first is fastest.
+    for (const auto& child : parent->children) {
+        if (child->name == name || std::strcmp(child->name, name) == 0) {
+            tree.current = child.get();
+            return tree.current;
+        }
+    }
+
+    auto node = std::make_unique<CallNode>();
+    node->name = name;
+    node->parent = parent;
+    parent->children.push_back(std::move(node));
+    tree.current = parent->children.back().get();
+    return tree.current;
+}
+
+void ScopeProfiler::exit(CallNode* node, std::uint64_t startNs, std::uint64_t durationNs) noexcept {
+    ThreadTree& tree = *t_tree;  // enter() registered the thread
+    ++node->calls;
+    node->inclusiveNs += durationNs;
+    node->parent->childrenNs += durationNs;
+    tree.current = node->parent;
+
+    if (tree.events.size() < tree.eventLimit) {
+        tree.events.push_back(TraceEvent{node->name, startNs, durationNs});
+    } else {
+        ++tree.droppedEvents;
+    }
+}
+
+void ScopeProfiler::writeCollapsedStacks(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+    for (const auto& tree : m_trees) {
+        for (const auto& child : tree->root.children) {
+            writeCollapsed(out, *child, "");
+        }
+    }
+}
+
+void ScopeProfiler::writeChromeTrace(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+
+    // Timestamps relative to the earliest event, in microseconds as the format expects.
+    std::uint64_t origin = std::numeric_limits<std::uint64_t>::max();
+    for (const auto& tree : m_trees) {
+        for (const TraceEvent& event : tree->events) {
+            origin = std::min(origin, event.startNs);
+        }
+    }
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    out << std::fixed << std::setprecision(3);
+    for (const auto& tree : m_trees) {
+        out << (first ? "" : ",")
+            << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tree->threadId
+            << ",\"args\":{\"name\":\"thread " << tree->threadId << "\"}}";
+        first = false;
+        for (const TraceEvent& event : tree->events) {
+            out << ",\n{\"name\":";
+            benchmark_detail::writeJsonString(out, event.name);
+            out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << tree->threadId
+                << ",\"ts\":" << static_cast<double>(event.startNs - origin) / 1000.0
+                << ",\"dur\":" << static_cast<double>(event.durationNs) / 1000.0 << "}";
+        }
+    }
+    out << "\n]}\n";
+}
+
+std::string ScopeProfiler::treeReport() const {
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    ss << "--- Scope Call Tree (ms) ---\n";
+    for (const auto& tree : m_trees) {
+        if (tree->root.children.empty()) {
+            continue;
+        }
+        ss << "Thread " << tree->threadId << "\n"
+           << "  " << std::left << std::setw(36) << "Scope" << std::right
+           << std::setw(10) << "Calls"
+           << std::setw(14) << "Inclusive"
+           << std::setw(14) << "Exclusive" << "\n";
+        for (const auto& child : tree->root.children) {
+            writeTree(ss, *child, 0);
+        }
+        if (tree->droppedEvents > 0) {
+            ss << "  Trace events dropped (limit " << tree->eventLimit << "): "
+               << tree->droppedEvents << "\n";
+        }
+    }
+    ss << "-------------------------------------";
+    return ss.str();
+}
+
+void ScopeProfiler::reset() {
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+    for (const auto& tree : m_trees) {
+        tree->root.children.clear();
+        tree->root.childrenNs = 0;
+        tree->current = &tree->root;
+        tree->events.clear();
+        tree->droppedEvents = 0;
+    }
+}
@@ -0,0 +1,109 @@
+#ifndef BENCHMARK_SCOPE_PROFILER_H
+#define BENCHMARK_SCOPE_PROFILER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @struct CallNode
+ * @brief One call path in a thread's call tree (e.g. "Process Order" -> "Price").
+ *
+ * The same scope name reached through different parents gets different nodes,
+ * which is what separates inclusive from exclusive time per call path.
+ */
+struct CallNode {
+    const char* name = nullptr;
+    CallNode* parent = nullptr;
+    std::vector<std::unique_ptr<CallNode>> children;
+    std::uint64_t calls = 0;
+    std::uint64_t inclusiveNs = 0;
+    std::uint64_t childrenNs = 0;   // inclusive time of all direct children
+
+    std::uint64_t exclusiveNs() const {
+        return inclusiveNs > childrenNs ? inclusiveNs - childrenNs : 0;
+    }
+};
+
+/**
+ * @struct TraceEvent
+ * @brief One completed scope, kept for the Chrome trace-event export.
+ */
+struct TraceEvent {
+    const char* name;
+    std::uint64_t startNs;
+    std::uint64_t durationNs;
+};
+
+/**
+ * @class ScopeProfiler
+ * @brief Builds a per-thread call tree from nested benchmark("...") scopes.
+ *
+ * Enabled with BENCHMARK_CALL_TREE (see Benchmark.h). Every ScopedBenchmark then
+ * enters a node under the scope that is currently open on the same thread and leaves
+ * it on destruction, so nesting in the source becomes parent/child relationships
+ * with call counts, inclusive and exclusive time.
+ * Each thread owns its tree, so recording takes no locks; a node is allocated only
+ * the first time a call path is seen, on scope entry. The trace-event buffer is
+ * reserved to its limit when the thread registers, so leaving a scope never allocates.
+ *
+ * Exports:
+ *   writeCollapsedStacks() - "a;b;c <exclusive ns>" lines for flamegraph.pl / speedscope
+ *   writeChromeTrace()     - trace-event JSON for chrome://tracing / Perfetto
+ *   treeReport()           - indented text tree
+ *
+ * Exports read the trees of all threads: call them when the instrumented threads
+ * have finished (or are outside instrumented scopes).
+ */
+class ScopeProfiler {
+public:
+    static constexpr std::size_t kDefaultTraceEventLimit = 100000;  // per thread
+
+    static ScopeProfiler& instance();
+
+    // Hot path, called by ScopedBenchmark on the measuring thread.
+    static CallNode* enter(const char* name);
+    static void exit(CallNode* node, std::uint64_t startNs, std::uint64_t durationNs) noexcept;
+
+    void writeCollapsedStacks(std::ostream& out) const;
+    void writeChromeTrace(std::ostream& out) const;
+    std::string treeReport() const;
+
+    // Maximum number of trace events kept per thread; further events are counted as dropped.
+    // Applies to threads that record their first scope after the call, which reserve
+    // limit * sizeof(TraceEvent) bytes up front.
+    void setTraceEventLimit(std::size_t limit) { m_traceEventLimit = limit; }
+
+    // Clears the call trees and trace events of all threads.
+    void reset();
+
+    ScopeProfiler(const ScopeProfiler&) = delete;
+    ScopeProfiler& operator=(const ScopeProfiler&) = delete;
+
+private:
+    struct ThreadTree {
+        std::uint32_t threadId = 0;
+        CallNode root;
+        CallNode* current = &root;
+        std::vector<TraceEvent> events;
+        std::size_t eventLimit = kDefaultTraceEventLimit;
+        std::uint64_t droppedEvents = 0;
+    };
+
+    ScopeProfiler() = default;
+
+    static ThreadTree& localTree();
+    static ThreadTree* registerThread();
+
+    static thread_local ThreadTree* t_tree;
+
+    mutable std::mutex m_registryMutex;
+    std::vector<std::shared_ptr<ThreadTree>> m_trees;  // kept after the thread exits
+    std::size_t m_traceEventLimit = kDefaultTraceEventLimit;
+};
+
+#endif // BENCHMARK_SCOPE_PROFILER_H
@@ -0,0 +1,66 @@
+#ifndef BENCHMARK_SPSC_RING_BUFFER_H
+#define BENCHMARK_SPSC_RING_BUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @class SpscRingBuffer
+ * @brief Bounded lock-free queue for exactly one producer and one consumer thread.
+ *
+ * push() never blocks and never allocates: when the buffer is full it returns false
+ * and the caller decides what to do (the sample collector counts a drop).
+ * Head and tail live on separate cache lines so the producer and the consumer
+ * do not invalidate each other's line on every operation.
+ *
+ * Capacity must be a power of two so the index wrap is a mask, not a division.
+ */
+template <typename T, std::size_t Capacity>
+class SpscRingBuffer {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of two");
+
+public:
+    // Producer side.
+    bool push(const T& item) noexcept {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_cachedTail == Capacity) {
+            // Looks full: refresh the consumer position (one shared-line read, not every push).
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head - m_cachedTail == Capacity) {
+                return false;
+            }
+        }
+        m_items[head & kMask] = item;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Calls `consume(const T&)` for every available item, returns the count.
+    template <typename Consumer>
+    std::size_t drain(Consumer&& consume) {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        const std::size_t head = m_head.load(std::memory_order_acquire);
+        for (std::size_t i = tail; i != head; ++i) {
+            consume(m_items[i & kMask]);
+        }
+        m_tail.store(head, std::memory_order_release);
+        return head - tail;
+    }
+
+    bool empty() const noexcept {
+        return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr std::size_t kMask = Capacity - 1;
+    static constexpr std::size_t kCacheLine = 64;
+
+    alignas(kCacheLine) std::atomic<std::size_t> m_head{0};  // written by the producer
+    std::size_t m_cachedTail = 0;                            // producer's copy of m_tail
+    alignas(kCacheLine) std::atomic<std::size_t> m_tail{0};  // written by the consumer
+    alignas(kCacheLine) std::array<T, Capacity> m_items{};
+};
+
+#endif // BENCHMARK_SPSC_RING_BUFFER_H
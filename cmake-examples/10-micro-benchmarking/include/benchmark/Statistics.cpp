@@ -0,0 +1,60 @@
+#include "benchmark/Statistics.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+MannWhitneyResult mannWhitneyU(const std::vector<double>& a, const std::vector<double>& b) {
+    MannWhitneyResult result;
+    if (a.empty() || b.empty()) {
+        return result;
+    }
+
+    // Pool both samples, remembering which side each value came from.
+    std::vector<std::pair<double, bool>> pooled;
+    pooled.reserve(a.size() + b.size());
+    for (double value : a) {
+        pooled.emplace_back(value, true);
+    }
+    for (double value : b) {
+        pooled.emplace_back(value, false);
+    }
+    std::sort(pooled.begin(), pooled.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    // Ranks start at 1; tied values share the average rank of their group.
+    double rankSumA = 0.0;
+    double tieTerm = 0.0;   // sum of (t^3 - t) over groups of t ties
+    for (std::size_t i = 0; i < pooled.size();) {
+        std::size_t j = i;
+        while (j < pooled.size() && pooled[j].first == pooled[i].first) {
+            ++j;
+        }
+        const double averageRank = (static_cast<double>(i + 1) + static_cast<double>(j)) / 2.0;
+        for (std::size_t k = i; k < j; ++k) {
+            if (pooled[k].second) {
+                rankSumA += averageRank;
+            }
+        }
+        const double ties = static_cast<double>(j - i);
+        tieTerm += ties * ties * ties - ties;
+        i = j;
+    }
+
+    const double n1 = static_cast<double>(a.size());
+    const double n2 = static_cast<double>(b.size());
+    const double n = n1 + n2;
+    result.u = rankSumA - n1 * (n1 + 1.0) / 2.0;
+    result.probabilityAGreater = result.u / (n1 * n2);
+
+    const double meanU = n1 * n2 / 2.0;
+    const double varianceU = n1 * n2 / 12.0 * ((n + 1.0) - tieTerm / (n * (n - 1.0)));
+    if (varianceU <= 0.0) {
+        return result;   // all values identical
+    }
+
+    const double difference = result.u - meanU;
+    const double corrected = std::max(0.0, std::abs(difference) - 0.5);
+    result.z = std::copysign(corrected / std::sqrt(varianceU), difference);
+    result.pValue = std::erfc(std::abs(result.z) / std::sqrt(2.0));
+    return result;
+}
@@ -0,0 +1,30 @@
+#ifndef BENCHMARK_STATISTICS_H
+#define BENCHMARK_STATISTICS_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @struct MannWhitneyResult
+ * @brief Outcome of a two-sided Mann-Whitney U test of `a` against `b`.
+ */
+struct MannWhitneyResult {
+    double u = 0.0;            // U statistic of sample a
+    double z = 0.0;            // normal approximation, > 0 when a tends to be larger
+    double pValue = 1.0;       // two-sided
+    // Probability that a random sample of a is larger than one of b (ties count half).
+    // 0.5 = no difference; this is the effect size, independent of the sample count.
+    double probabilityAGreater = 0.5;
+};
+
+/**
+ * @brief Mann-Whitney U (Wilcoxon rank-sum) test.
+ *
+ * Latency samples are skewed and have outliers, so comparing means with a t-test
+ * flags noise; the rank test only asks whether one distribution is shifted against
+ * the other. Uses the normal approximation with tie correction and continuity
+ * correction, which is accurate for about 10 or more samples per side.
+ */
+MannWhitneyResult mannWhitneyU(const std::vector<double>& a, const std::vector<double>& b);
+
+#endif // BENCHMARK_STATISTICS_H
@@ -0,0 +1,14 @@
+#ifndef ORDER_H
+#define ORDER_H
+
+// --- Simple Fintech Simulation ---
+
+// Array-of-structures order record, as received from the order entry path.
+struct Order {
+    int id;
+    double price;
+    int quantity;
+    enum Side { BUY, SELL } side;
+};
+
+#endif // ORDER_H
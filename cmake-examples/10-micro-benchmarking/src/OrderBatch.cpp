@@ -0,0 +1,22 @@
+#include "OrderBatch.h"
+
+OrderBatch::OrderBatch(const std::vector<Order>& orders) {
+    reserve(orders.size());
+    for (const auto& order : orders) {
+        push_back(order);
+    }
+}
+
+void OrderBatch::reserve(std::size_t count) {
+    m_prices.reserve(count);
+    m_quantities.reserve(count);
+    m_sides.reserve(count);
+    m_ids.reserve(count);
+}
+
+void OrderBatch::push_back(const Order& order) {
+    m_prices.push_back(order.price);
+    m_quantities.push_back(order.quantity);
+    m_sides.push_back(static_cast<std::uint8_t>(order.side));
+    m_ids.push_back(order.id);
+}
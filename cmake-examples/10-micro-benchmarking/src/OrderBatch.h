@@ -0,0 +1,81 @@
+#ifndef ORDER_BATCH_H
+#define ORDER_BATCH_H
+
+#include "Order.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+/**
+ * @brief Allocator returning memory aligned to `Alignment` bytes.
+ *
+ * 64-byte alignment puts every array on a cache-line boundary, so a full AVX-512
+ * load never straddles two cache lines.
+ */
+template <typename T, std::size_t Alignment = 64>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(std::size_t count) {
+        // std::aligned_alloc requires the size to be a multiple of the alignment.
+        std::size_t bytes = (count * sizeof(T) + Alignment - 1) / Alignment * Alignment;
+        void* memory = std::aligned_alloc(Alignment, bytes);
+        if (memory == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(memory);
+    }
+
+    void deallocate(T* pointer, std::size_t) noexcept { std::free(pointer); }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+};
+
+template <typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+/**
+ * @class OrderBatch
+ * @brief Struct-of-arrays container for orders.
+ *
+ * A kernel that only needs prices and quantities streams through exactly those
+ * two arrays instead of dragging whole 24-byte Order records through the cache,
+ * and consecutive prices can be loaded straight into SIMD registers.
+ */
+class OrderBatch {
+public:
+    OrderBatch() = default;
+    explicit OrderBatch(const std::vector<Order>& orders);
+
+    void reserve(std::size_t count);
+    void push_back(const Order& order);
+
+    std::size_t size() const { return m_prices.size(); }
+
+    const double* prices() const { return m_prices.data(); }
+    const std::int32_t* quantities() const { return m_quantities.data(); }
+    const std::uint8_t* sides() const { return m_sides.data(); }
+    const std::int32_t* ids() const { return m_ids.data(); }
+
+private:
+    AlignedVector<double> m_prices;
+    AlignedVector<std::int32_t> m_quantities;
+    AlignedVector<std::uint8_t> m_sides;     // Order::Side
+    AlignedVector<std::int32_t> m_ids;
+};
+
+#endif // ORDER_BATCH_H
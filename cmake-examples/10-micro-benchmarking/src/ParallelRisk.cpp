@@ -0,0 +1,40 @@
+#include "ParallelRisk.h"
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+// Pairwise (cascade) summation over [begin, end): fixed tree shape, O(log n) error growth.
+RiskSums pairwiseSum(const std::vector<RiskSums>& partials, std::size_t begin, std::size_t end) {
+    if (end - begin == 1) {
+        return partials[begin];
+    }
+    const std::size_t middle = begin + (end - begin) / 2;
+    const RiskSums left = pairwiseSum(partials, begin, middle);
+    const RiskSums right = pairwiseSum(partials, middle, end);
+    return RiskSums{left.notional + right.notional, left.logPriceSum + right.logPriceSum};
+}
+
+} // namespace
+
+RiskSums computeRiskSumsParallel(const double* prices, const std::int32_t* quantities, std::size_t count,
+                                 ThreadPool& pool) {
+    if (count == 0) {
+        return RiskSums{};
+    }
+
+    const std::size_t chunks = (count + kRiskChunkSize - 1) / kRiskChunkSize;
+    std::vector<RiskSums> partials(chunks);
+
+    pool.parallelFor(chunks, [&](std::size_t chunk) {
+        const std::size_t begin = chunk * kRiskChunkSize;
+        const std::size_t size = std::min(kRiskChunkSize, count - begin);
+        partials[chunk] = computeRiskSums(prices + begin, quantities + begin, size);
+    });
+
+    return pairwiseSum(partials, 0, chunks);
+}
+
+double calculatePortfolioRiskParallel(const OrderBatch& batch, ThreadPool& pool) {
+    return riskFromSums(computeRiskSumsParallel(batch.prices(), batch.quantities(), batch.size(), pool));
+}
@@ -0,0 +1,31 @@
+#ifndef PARALLEL_RISK_H
+#define PARALLEL_RISK_H
+
+#include "OrderBatch.h"
+#include "RiskKernels.h"
+#include "ThreadPool.h"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Orders per chunk. The chunking depends only on the order count, never on the
+ * number of threads, which is what makes the parallel result reproducible.
+ * 64k orders (~768 KB of prices and quantities) is large enough to amortize the
+ * task hand-off and small enough to balance load across cores.
+ */
+constexpr std::size_t kRiskChunkSize = 64 * 1024;
+
+/**
+ * @brief Computes RiskSums across the pool's threads with a deterministic reduction.
+ *
+ * Each fixed-size chunk is reduced by the SIMD kernel into its own slot (the kernels
+ * are bit-identical across ISAs), then the slots are combined by pairwise summation
+ * over chunk indices. The result is bit-identical for any thread count and on any
+ * x86 machine, unlike std::execution::par reductions whose summation order varies.
+ */
+RiskSums computeRiskSumsParallel(const double* prices, const std::int32_t* quantities, std::size_t count,
+                                 ThreadPool& pool);
+
+double calculatePortfolioRiskParallel(const OrderBatch& batch, ThreadPool& pool);
+
+#endif // PARALLEL_RISK_H
@@ -0,0 +1,51 @@
+#ifndef RISK_FIXTURES_H
+#define RISK_FIXTURES_H
+
+#include "benchmark/BenchmarkRunner.h"
+#include "Order.h"
+#include "OrderBatch.h"
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+// Synthetic portfolio and runner settings shared by the registered risk cases
+// (risk_cases.cpp) and the risk_benchmark / parallel_risk_benchmark reports.
+
+// The i-th order of the synthetic portfolio: prices 150.00-150.99, 10-16 lots, 1/3 sells.
+inline Order makeOrder(std::size_t i) {
+    return {static_cast<int>(i), 150.0 + static_cast<double>(i % 100) / 100.0,
+            10 + static_cast<int>(i % 7), (i % 3) ? Order::BUY : Order::SELL};
+}
+
+inline std::vector<Order> makeOrders(std::size_t count) {
+    std::vector<Order> orders;
+    orders.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        orders.push_back(makeOrder(i));
+    }
+    return orders;
+}
+
+// Same orders, filled straight into the struct-of-arrays container (no AoS copy at 50M orders).
+inline OrderBatch makeOrderBatch(std::size_t count) {
+    OrderBatch batch;
+    batch.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        batch.push_back(makeOrder(i));
+    }
+    return batch;
+}
+
+// Adaptive runs to a 2% confidence interval, at most 3 s per point.
+inline RunnerConfig riskRunnerConfig() {
+    RunnerConfig config;
+    config.warmupIterations = 2;
+    config.adaptive = true;
+    config.minIterations = 5;
+    config.maxIterations = 1000;
+    config.targetRelativeCi = 0.02;
+    config.maxTime = std::chrono::seconds(3);
+    return config;
+}
+
+#endif // RISK_FIXTURES_H
@@ -0,0 +1,94 @@
+#include "RiskKernels.h"
+#include "RiskKernelsDetail.h"
+#include <cmath>
+
+namespace risk_detail {
+
+RiskSums computeRiskSumsScalar(const double* prices, const std::int32_t* quantities, std::size_t count) {
+    double notional[kLanes] = {};
+    double logSum[kLanes] = {};
+    accumulateScalar(prices, quantities, 0, count, notional, logSum);
+    return RiskSums{combineLanes(notional), combineLanes(logSum)};
+}
+
+} // namespace risk_detail
+
+const char* riskKernelIsaName(RiskKernelIsa isa) {
+    switch (isa) {
+        case RiskKernelIsa::Scalar: return "scalar";
+        case RiskKernelIsa::Avx2:   return "avx2";
+        case RiskKernelIsa::Avx512: return "avx512";
+    }
+    return "unknown";
+}
+
+bool isRiskKernelSupported(RiskKernelIsa isa) {
+    switch (isa) {
+        case RiskKernelIsa::Scalar:
+            return true;
+        case RiskKernelIsa::Avx2:
+#ifdef RISK_KERNELS_AVX2
+            return __builtin_cpu_supports("avx2");
+#else
+            return false;
+#endif
+        case RiskKernelIsa::Avx512:
+#ifdef RISK_KERNELS_AVX512
+            return __builtin_cpu_supports("avx512f");
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+RiskKernelIsa bestRiskKernel() {
+    static const RiskKernelIsa best = [] {
+        if (isRiskKernelSupported(RiskKernelIsa::Avx512)) {
+            return RiskKernelIsa::Avx512;
+        }
+        if (isRiskKernelSupported(RiskKernelIsa::Avx2)) {
+            return RiskKernelIsa::Avx2;
+        }
+        return RiskKernelIsa::Scalar;
+    }();
+    return best;
+}
+
+RiskSums computeRiskSums(const double* prices, const std::int32_t* quantities, std::size_t count,
+                         RiskKernelIsa isa) {
+    switch (isa) {
+#ifdef RISK_KERNELS_AVX512
+        case RiskKernelIsa::Avx512:
+            return risk_detail::computeRiskSumsAvx512(prices, quantities, count);
+#endif
+#ifdef RISK_KERNELS_AVX2
+        case RiskKernelIsa::Avx2:
+            return risk_detail::computeRiskSumsAvx2(prices, quantities, count);
+#endif
+        default:
+            return risk_detail::computeRiskSumsScalar(prices, quantities, count);
+    }
+}
+
+double riskFromSums(const RiskSums& sums) {
+    return sums.logPriceSum * std::sqrt(sums.notional) / sums.notional;
+}
+
+double calculatePortfolioRisk(const OrderBatch& batch, RiskKernelIsa isa) {
+    return riskFromSums(computeRiskSums(batch.prices(), batch.quantities(), batch.size(), isa));
+}
+
+double calculatePortfolioRisk(const std::vector<Order>& orders) {
+    double totalValue = 0.0;
+    for (const auto& order : orders) {
+        totalValue += order.price * order.quantity;
+    }
+
+    double risk = 0.0;
+    for (size_t i = 0; i < orders.size(); ++i) {
+        risk += std::log(orders[i].price) * std::sqrt(totalValue);
+    }
+
+    return risk / totalValue;
+}
@@ -0,0 +1,53 @@
+#ifndef RISK_KERNELS_H
+#define RISK_KERNELS_H
+
+#include "Order.h"
+#include "OrderBatch.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct RiskSums
+ * @brief The two reductions the portfolio risk is built from.
+ */
+struct RiskSums {
+    double notional = 0.0;     // sum(price * quantity)
+    double logPriceSum = 0.0;  // sum(log(price))
+};
+
+enum class RiskKernelIsa { Scalar, Avx2, Avx512 };
+
+const char* riskKernelIsaName(RiskKernelIsa isa);
+
+// True if the kernel was compiled in and the CPU/OS supports it.
+bool isRiskKernelSupported(RiskKernelIsa isa);
+
+// Widest supported kernel, detected once at runtime.
+RiskKernelIsa bestRiskKernel();
+
+/**
+ * @brief Computes RiskSums over `count` orders stored as separate price/quantity arrays.
+ *
+ * Every kernel uses the same polynomial log and accumulates element i into lane i % 8
+ * before combining the 8 lanes in a fixed order, so the scalar, AVX2 and AVX-512
+ * kernels return bit-identical sums. Prices must be positive and finite.
+ */
+RiskSums computeRiskSums(const double* prices, const std::int32_t* quantities, std::size_t count,
+                         RiskKernelIsa isa);
+
+inline RiskSums computeRiskSums(const double* prices, const std::int32_t* quantities, std::size_t count) {
+    return computeRiskSums(prices, quantities, count, bestRiskKernel());
+}
+
+// risk = sum(log(price)) * sqrt(notional) / notional
+double riskFromSums(const RiskSums& sums);
+
+// Struct-of-arrays version: one pass, sqrt(totalValue) hoisted out of the loop, SIMD dispatch.
+double calculatePortfolioRisk(const OrderBatch& batch, RiskKernelIsa isa = bestRiskKernel());
+
+// Reference array-of-structures version: the original two-pass loop over Order records.
+// The one AoS implementation; the demo and the benchmarks compare against it.
+double calculatePortfolioRisk(const std::vector<Order>& orders);
+
+#endif // RISK_KERNELS_H
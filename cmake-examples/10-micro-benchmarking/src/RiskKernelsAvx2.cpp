@@ -0,0 +1,71 @@
+// Compiled with -mavx2; only called after a runtime CPU check.
+#include "RiskKernelsDetail.h"
+#include <immintrin.h>
+
+namespace risk_detail {
+
+namespace {
+
+// Vector twin of polynomialLog(): the same operations in the same order, 4 lanes at a time.
+inline __m256d log4(__m256d x) {
+    const __m256i bits = _mm256_castpd_si256(x);
+    const __m256i exponentField = _mm256_srli_epi64(bits, 52);
+    const __m256d exponentBits = _mm256_sub_pd(
+        _mm256_castsi256_pd(_mm256_or_si256(exponentField, _mm256_set1_epi64x(static_cast<long long>(kMagicBits)))),
+        _mm256_set1_pd(kTwo52));
+    __m256d m = _mm256_castsi256_pd(_mm256_or_si256(
+        _mm256_and_si256(bits, _mm256_set1_epi64x(static_cast<long long>(kMantissaMask))),
+        _mm256_set1_epi64x(static_cast<long long>(kOneBits))));
+
+    const __m256d big = _mm256_cmp_pd(m, _mm256_set1_pd(kSqrt2), _CMP_GT_OQ);
+    m = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), big);
+    const __m256d e = _mm256_add_pd(_mm256_sub_pd(exponentBits, _mm256_set1_pd(kExponentBias)),
+                                    _mm256_and_pd(big, _mm256_set1_pd(1.0)));
+
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d s = _mm256_div_pd(_mm256_sub_pd(m, one), _mm256_add_pd(m, one));
+    const __m256d z = _mm256_mul_pd(s, s);
+    __m256d p = _mm256_set1_pd(kLogCoefficients[0]);
+    for (std::size_t k = 1; k < sizeof(kLogCoefficients) / sizeof(double); ++k) {
+        p = _mm256_add_pd(_mm256_mul_pd(p, z), _mm256_set1_pd(kLogCoefficients[k]));
+    }
+    const __m256d t = _mm256_add_pd(s, s);
+    const __m256d tail = _mm256_add_pd(_mm256_mul_pd(t, _mm256_mul_pd(z, p)),
+                                       _mm256_mul_pd(e, _mm256_set1_pd(kLn2Lo)));
+    return _mm256_add_pd(_mm256_mul_pd(e, _mm256_set1_pd(kLn2Hi)), _mm256_add_pd(t, tail));
+}
+
+} // namespace
+
+RiskSums computeRiskSumsAvx2(const double* prices, const std::int32_t* quantities, std::size_t count) {
+    // Two 4-wide accumulators = the 8 canonical lanes (elements 8k..8k+3 and 8k+4..8k+7).
+    __m256d notionalLo = _mm256_setzero_pd();
+    __m256d notionalHi = _mm256_setzero_pd();
+    __m256d logLo = _mm256_setzero_pd();
+    __m256d logHi = _mm256_setzero_pd();
+
+    const std::size_t blocked = count - count % kLanes;
+    for (std::size_t i = 0; i < blocked; i += kLanes) {
+        const __m256d priceLo = _mm256_loadu_pd(prices + i);
+        const __m256d priceHi = _mm256_loadu_pd(prices + i + 4);
+        const __m256d qtyLo = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(quantities + i)));
+        const __m256d qtyHi = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(quantities + i + 4)));
+
+        notionalLo = _mm256_add_pd(notionalLo, _mm256_mul_pd(priceLo, qtyLo));
+        notionalHi = _mm256_add_pd(notionalHi, _mm256_mul_pd(priceHi, qtyHi));
+        logLo = _mm256_add_pd(logLo, log4(priceLo));
+        logHi = _mm256_add_pd(logHi, log4(priceHi));
+    }
+
+    double notional[kLanes];
+    double logSum[kLanes];
+    _mm256_storeu_pd(notional, notionalLo);
+    _mm256_storeu_pd(notional + 4, notionalHi);
+    _mm256_storeu_pd(logSum, logLo);
+    _mm256_storeu_pd(logSum + 4, logHi);
+    accumulateScalar(prices, quantities, blocked, count, notional, logSum);
+
+    return RiskSums{combineLanes(notional), combineLanes(logSum)};
+}
+
+} // namespace risk_detail
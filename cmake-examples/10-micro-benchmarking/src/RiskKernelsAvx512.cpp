@@ -0,0 +1,63 @@
+// Compiled with -mavx512f; only called after a runtime CPU check.
+#include "RiskKernelsDetail.h"
+#include <immintrin.h>
+
+namespace risk_detail {
+
+namespace {
+
+// Vector twin of polynomialLog(): the same operations in the same order, 8 lanes at a time.
+inline __m512d log8(__m512d x) {
+    const __m512i bits = _mm512_castpd_si512(x);
+    const __m512i exponentField = _mm512_srli_epi64(bits, 52);
+    const __m512d exponentBits = _mm512_sub_pd(
+        _mm512_castsi512_pd(_mm512_or_si512(exponentField, _mm512_set1_epi64(static_cast<long long>(kMagicBits)))),
+        _mm512_set1_pd(kTwo52));
+    __m512d m = _mm512_castsi512_pd(_mm512_or_si512(
+        _mm512_and_si512(bits, _mm512_set1_epi64(static_cast<long long>(kMantissaMask))),
+        _mm512_set1_epi64(static_cast<long long>(kOneBits))));
+
+    const __mmask8 big = _mm512_cmp_pd_mask(m, _mm512_set1_pd(kSqrt2), _CMP_GT_OQ);
+    m = _mm512_mask_mul_pd(m, big, m, _mm512_set1_pd(0.5));
+    __m512d e = _mm512_sub_pd(exponentBits, _mm512_set1_pd(kExponentBias));
+    e = _mm512_mask_add_pd(e, big, e, _mm512_set1_pd(1.0));
+
+    const __m512d one = _mm512_set1_pd(1.0);
+    const __m512d s = _mm512_div_pd(_mm512_sub_pd(m, one), _mm512_add_pd(m, one));
+    const __m512d z = _mm512_mul_pd(s, s);
+    __m512d p = _mm512_set1_pd(kLogCoefficients[0]);
+    for (std::size_t k = 1; k < sizeof(kLogCoefficients) / sizeof(double); ++k) {
+        p = _mm512_add_pd(_mm512_mul_pd(p, z), _mm512_set1_pd(kLogCoefficients[k]));
+    }
+    const __m512d t = _mm512_add_pd(s, s);
+    const __m512d tail = _mm512_add_pd(_mm512_mul_pd(t, _mm512_mul_pd(z, p)),
+                                       _mm512_mul_pd(e, _mm512_set1_pd(kLn2Lo)));
+    return _mm512_add_pd(_mm512_mul_pd(e, _mm512_set1_pd(kLn2Hi)), _mm512_add_pd(t, tail));
+}
+
+} // namespace
+
+RiskSums computeRiskSumsAvx512(const double* prices, const std::int32_t* quantities, std::size_t count) {
+    // One 8-wide accumulator: lane j holds the elements i with i % 8 == j.
+    __m512d notionalAcc = _mm512_setzero_pd();
+    __m512d logAcc = _mm512_setzero_pd();
+
+    const std::size_t blocked = count - count % kLanes;
+    for (std::size_t i = 0; i < blocked; i += kLanes) {
+        const __m512d price = _mm512_loadu_pd(prices + i);
+        const __m512d qty = _mm512_cvtepi32_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(quantities + i)));
+
+        notionalAcc = _mm512_add_pd(notionalAcc, _mm512_mul_pd(price, qty));
+        logAcc = _mm512_add_pd(logAcc, log8(price));
+    }
+
+    double notional[kLanes];
+    double logSum[kLanes];
+    _mm512_storeu_pd(notional, notionalAcc);
+    _mm512_storeu_pd(logSum, logAcc);
+    accumulateScalar(prices, quantities, blocked, count, notional, logSum);
+
+    return RiskSums{combineLanes(notional), combineLanes(logSum)};
+}
+
+} // namespace risk_detail
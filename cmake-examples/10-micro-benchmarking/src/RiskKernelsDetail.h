@@ -0,0 +1,88 @@
+#ifndef RISK_KERNELS_DETAIL_H
+#define RISK_KERNELS_DETAIL_H
+
+// Internal to the risk kernels: shared constants and the scalar reference math.
+// Every kernel TU must perform exactly the same IEEE operations in the same order
+// (and is compiled with -ffp-contract=off), which is what makes results bit-identical.
+
+#include "RiskKernels.h"
+#include <cstdint>
+#include <cstring>
+
+namespace risk_detail {
+
+constexpr std::size_t kLanes = 8;
+
+constexpr std::uint64_t kMantissaMask = 0x000FFFFFFFFFFFFFull;
+constexpr std::uint64_t kOneBits = 0x3FF0000000000000ull;       // 1.0
+constexpr std::uint64_t kMagicBits = 0x4330000000000000ull;     // 2^52, for int -> double
+constexpr double kTwo52 = 4503599627370496.0;
+constexpr double kSqrt2 = 1.41421356237309504880;
+constexpr double kExponentBias = 1023.0;
+// ln(2) split so that e * kLn2Hi is exact for any double exponent.
+constexpr double kLn2Hi = 6.93147180369123816490e-01;
+constexpr double kLn2Lo = 1.90821492927058770002e-10;
+
+// log(m) = 2s + 2s * z * P(z), s = (m - 1) / (m + 1), z = s^2, P(z) = sum z^k / (2k + 3).
+// With m in [sqrt(2)/2, sqrt(2)], |s| <= 0.1716 and ten terms reach double precision.
+constexpr double kLogCoefficients[] = {
+    1.0 / 21.0, 1.0 / 19.0, 1.0 / 17.0, 1.0 / 15.0, 1.0 / 13.0,
+    1.0 / 11.0, 1.0 / 9.0,  1.0 / 7.0,  1.0 / 5.0,  1.0 / 3.0,
+};
+
+inline std::uint64_t toBits(double value) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+inline double fromBits(std::uint64_t bits) {
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Scalar twin of the SIMD log. Not std::log: this one matches the vector kernels bit for bit.
+inline double polynomialLog(double x) {
+    const std::uint64_t bits = toBits(x);
+    const double exponentBits = fromBits((bits >> 52) | kMagicBits) - kTwo52;
+    double m = fromBits((bits & kMantissaMask) | kOneBits);
+    const bool big = m > kSqrt2;
+    if (big) {
+        m = m * 0.5;
+    }
+    const double e = (exponentBits - kExponentBias) + (big ? 1.0 : 0.0);
+
+    const double s = (m - 1.0) / (m + 1.0);
+    const double z = s * s;
+    double p = kLogCoefficients[0];
+    for (std::size_t k = 1; k < sizeof(kLogCoefficients) / sizeof(double); ++k) {
+        p = p * z + kLogCoefficients[k];
+    }
+    const double t = s + s;
+    return e * kLn2Hi + (t + (t * (z * p) + e * kLn2Lo));
+}
+
+// Fixed pairwise combination of the 8 lanes, used by every kernel.
+inline double combineLanes(const double lanes[kLanes]) {
+    return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) +
+           ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+}
+
+// Adds elements [begin, end) into their lanes (i % 8); used for tails.
+inline void accumulateScalar(const double* prices, const std::int32_t* quantities,
+                             std::size_t begin, std::size_t end,
+                             double notional[kLanes], double logSum[kLanes]) {
+    for (std::size_t i = begin; i < end; ++i) {
+        notional[i % kLanes] += prices[i] * static_cast<double>(quantities[i]);
+        logSum[i % kLanes] += polynomialLog(prices[i]);
+    }
+}
+
+RiskSums computeRiskSumsScalar(const double* prices, const std::int32_t* quantities, std::size_t count);
+RiskSums computeRiskSumsAvx2(const double* prices, const std::int32_t* quantities, std::size_t count);
+RiskSums computeRiskSumsAvx512(const double* prices, const std::int32_t* quantities, std::size_t count);
+
+} // namespace risk_detail
+
+#endif // RISK_KERNELS_DETAIL_H
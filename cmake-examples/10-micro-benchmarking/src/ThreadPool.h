@@ -0,0 +1,54 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Fixed set of worker threads for fork-join loops.
+ *
+ * parallelFor() hands out task indices from a shared counter, so fast threads
+ * take more tasks. Which thread runs which task is not deterministic: callers
+ * that need reproducible results must write each task's result to its own slot
+ * and combine the slots in a fixed order afterwards.
+ * The calling thread takes part in the work, so ThreadPool(1) runs everything inline.
+ */
+class ThreadPool {
+public:
+    explicit ThreadPool(std::size_t threadCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Number of threads working on a parallelFor(), including the caller.
+    std::size_t size() const { return m_workers.size() + 1; }
+
+    // Runs task(0) ... task(taskCount - 1) and returns when all have finished.
+    void parallelFor(std::size_t taskCount, const std::function<void(std::size_t)>& task);
+
+private:
+    void workerLoop();
+    void runTasks();
+
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    const std::function<void(std::size_t)>* m_task = nullptr;
+    std::size_t m_taskCount = 0;
+    std::atomic<std::size_t> m_nextTask{0};
+    std::size_t m_busyWorkers = 0;
+    std::uint64_t m_generation = 0;
+    bool m_stop = false;
+};
+
+#endif // THREAD_POOL_H
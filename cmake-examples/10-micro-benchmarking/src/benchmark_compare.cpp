@@ -0,0 +1,148 @@
+#include "benchmark/ResultStore.h"
+#include "benchmark/Statistics.h"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+// Compares two result files written by `benchmark_runner --json=<file>` and flags
+// statistically significant regressions with a Mann-Whitney U test on the raw samples.
+//
+// Usage: benchmark_compare <baseline.json> <candidate.json> [--alpha=0.05] [--threshold=0.02]
+//   alpha      significance level of the two-sided test
+//   threshold  minimum relative change of the median worth reporting
+// Exits with 1 if any benchmark regressed, so it can gate a CI job.
+
+namespace {
+
+struct PooledSamples {
+    std::vector<double> samples;   // all repetitions of one benchmark point
+    std::size_t repetitions = 0;
+};
+
+// Preserves the order of first appearance, so the report follows the run order.
+std::vector<std::pair<std::string, PooledSamples>> poolByName(const ResultFile& file) {
+    std::vector<std::pair<std::string, PooledSamples>> pooled;
+    std::map<std::string, std::size_t> index;
+    for (const BenchmarkResult& result : file.results) {
+        auto [it, inserted] = index.emplace(result.name, pooled.size());
+        if (inserted) {
+            pooled.emplace_back(result.name, PooledSamples{});
+        }
+        PooledSamples& target = pooled[it->second].second;
+        target.samples.insert(target.samples.end(), result.stats.samples.begin(), result.stats.samples.end());
+        ++target.repetitions;
+    }
+    return pooled;
+}
+
+ResultFile load(const char* path) {
+    std::ifstream in(path);
+    if (!in) {
+        throw std::runtime_error(std::string("cannot open ") + path);
+    }
+    return readResultsJson(in);
+}
+
+void printContext(const char* label, const HostInfo& host) {
+    std::cout << label << host.cpuModel << ", " << host.compiler
+              << ", " << host.buildType << " [" << host.buildFlags << "], " << host.timestamp << "\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    double alpha = 0.05;
+    double threshold = 0.02;
+    std::vector<const char*> files;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], "--alpha=", 8) == 0) {
+            alpha = std::atof(argv[i] + 8);
+        } else if (std::strncmp(argv[i], "--threshold=", 12) == 0) {
+            threshold = std::atof(argv[i] + 12);
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+    if (files.size() != 2) {
+        std::cerr << "Usage: " << argv[0] << " <baseline.json> <candidate.json> [--alpha=0.05] [--threshold=0.02]\n";
+        return 2;
+    }
+
+    ResultFile baseline;
+    ResultFile candidate;
+    try {
+        baseline = load(files[0]);
+        candidate = load(files[1]);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 2;
+    }
+
+    printContext("Baseline:  ", baseline.host);
+    printContext("Candidate: ", candidate.host);
+    if (baseline.host.cpuModel != candidate.host.cpuModel || baseline.host.compiler != candidate.host.compiler ||
+        baseline.host.buildFlags != candidate.host.buildFlags) {
+        std::cout << "WARNING: CPU, compiler or build flags differ; differences may not be caused by the code.\n";
+    }
+    std::cout << "\n";
+
+    std::map<std::string, PooledSamples> candidateByName;
+    for (auto& [name, pooled] : poolByName(candidate)) {
+        candidateByName.emplace(name, std::move(pooled));
+    }
+
+    std::cout << std::left << std::setw(44) << "Benchmark" << std::right
+              << std::setw(14) << "Base median"
+              << std::setw(14) << "New median"
+              << std::setw(10) << "Change"
+              << std::setw(11) << "p-value"
+              << std::setw(8) << "P(>)"
+              << "   Verdict\n"
+              << std::string(110, '-') << "\n";
+
+    std::size_t regressions = 0;
+    for (const auto& [name, base] : poolByName(baseline)) {
+        const auto found = candidateByName.find(name);
+        if (found == candidateByName.end()) {
+            std::cout << std::left << std::setw(44) << name << std::right << "   missing in candidate\n";
+            continue;
+        }
+        const PooledSamples& next = found->second;
+
+        const double baseMedian = BenchmarkStats::fromSamples(base.samples).median;
+        const double nextMedian = BenchmarkStats::fromSamples(next.samples).median;
+        const double change = baseMedian > 0.0 ? nextMedian / baseMedian - 1.0 : 0.0;
+        // Candidate against baseline: P(>) above 0.5 means the candidate tends to be slower.
+        const MannWhitneyResult test = mannWhitneyU(next.samples, base.samples);
+
+        const char* verdict = "no significant change";
+        if (test.pValue < alpha && change > threshold) {
+            verdict = "REGRESSION";
+            ++regressions;
+        } else if (test.pValue < alpha && change < -threshold) {
+            verdict = "improved";
+        }
+
+        std::cout << std::left << std::setw(44) << name << std::right
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(14) << baseMedian
+                  << std::setw(14) << nextMedian
+                  << std::setw(9) << std::showpos << change * 100.0 << "%" << std::noshowpos
+                  << std::setw(11) << std::setprecision(4) << test.pValue
+                  << std::setw(8) << std::setprecision(2) << test.probabilityAGreater
+                  << "   " << verdict;
+        if (base.samples.size() < 10 || next.samples.size() < 10) {
+            std::cout << " (few samples, test unreliable)";
+        }
+        std::cout << "\n";
+    }
+
+    std::cout << "\n" << regressions << " regression(s) at alpha " << alpha
+              << ", threshold " << threshold * 100.0 << "%\n";
+    return regressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,9 @@
+#include "benchmark/Registry.h"
+
+// Runs all benchmarks registered with BENCHMARK_REGISTER in the linked case files.
+// See runBenchmarksFromCommandLine() for the options, e.g.
+//   benchmark_runner --filter=riskSoA --param=orders=1000,1000000 --repetitions=3
+
+int main(int argc, char* argv[]) {
+    return runBenchmarksFromCommandLine(argc, argv);
+}
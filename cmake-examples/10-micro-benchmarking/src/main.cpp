@@ -1,38 +1,38 @@
 #include "benchmark/Benchmark.h"
+#include "benchmark/BenchmarkRunner.h"
+#include "Order.h"
+#include "RiskKernels.h"
+#include <fstream>
 #include <iostream>
 #include <vector>
 #include <string>
 #include <numeric>
-#include <cmath>
-#include <thread> // For std::this_thread::sleep_for
-
-// --- Simple Fintech Simulation ---
-
-struct Order {
-    int id;
-    double price;
-    int quantity;
-    enum Side { BUY, SELL } side;
-};
-
-// A dummy function to simulate complex risk calculation
-double calculatePortfolioRisk(const std::vector<Order>& orders) {
-    // Simulate a CPU-intensive calculation
-    double totalValue = 0.0;
-    for (const auto& order : orders) {
-        totalValue += order.price * order.quantity;
-    }
+#include <thread>
 
-    // Simulate some more work, like calculating volatility or VaR
-    double risk = 0.0;
-    for (size_t i = 0; i < orders.size(); ++i) {
-        risk += std::log(orders[i].price) * std::sqrt(totalValue);
-    }
+// --- Instrumented order-processing path ---
+// Each function opens a scope; nested calls become children in the call tree.
 
-    // Pretend this calculation takes some time
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
-    
-    return risk / totalValue;
+bool validateOrder(const Order& order) {
+    benchmark("Validate");
+    return order.price > 0.0 && order.quantity > 0;
+}
+
+double priceOrder(const Order& order) {
+    benchmark("Price");
+    double notional = order.price * order.quantity;
+    return order.side == Order::BUY ? notional : -notional;
+}
+
+double processOrders(const std::vector<Order>& orders) {
+    benchmark("Process Orders");
+    double exposure = 0.0;
+    for (const auto& order : orders) {
+        benchmark("Process Order");
+        if (validateOrder(order)) {
+            exposure += priceOrder(order);
+        }
+    }
+    return exposure;
 }
 
 int main() {
@@ -42,10 +42,11 @@ int main() {
     orders.reserve(50000);
 
     // --- 1. RAII-style (scoped) benchmark ---
-    // The benchmark starts here and will automatically stop and print
-    // when the scope (the curly braces) ends.
+    // The benchmark starts here and will automatically stop and record a sample
+    // when the scope (the curly braces) ends. The sample is aggregated in the
+    // background and printed in the summary at the end of the program.
     {
-        benchmark("Order Batch Processing"); // Macro creates a ScopedBenchmark
+        benchmark_counters("Order Batch Processing"); // ScopedBenchmark that also captures hardware counters
         
         std::cout << "Processing a batch of 50,000 orders...\n";
         for (int i = 0; i < 50000; ++i) {
@@ -60,7 +61,9 @@ int main() {
     // Here we have full control over the start and stop times.
     std::cout << "Starting portfolio risk calculation...\n";
     
-    Benchmark riskBenchmark("Portfolio Risk Calculation");
+    // HardwareCounters mode also reports instructions, IPC, cache and branch misses
+    // and context switches of this region (time-only if perf counters are unavailable).
+    Benchmark riskBenchmark("Portfolio Risk Calculation", BenchmarkMode::HardwareCounters);
     
     riskBenchmark.start();
     
@@ -72,5 +75,73 @@ int main() {
     std::cout << riskBenchmark.toString() << std::endl;
     std::cout << "Calculated Portfolio Risk Factor: " << calculatedRisk << "\n\n";
 
+
+    // --- 3. Statistical benchmark ---
+    // A single start/end pair can be skewed by a cold cache or a context switch.
+    // The runner warms up first and then times every iteration separately.
+    std::cout << "Running portfolio risk calculation repeatedly...\n";
+
+    RunnerConfig config;
+    config.warmupIterations = 2;
+    config.iterations = 20;
+
+    BenchmarkRunner riskRunner("Portfolio Risk Calculation (statistical)", config);
+    riskRunner.run([&] { return calculatePortfolioRisk(orders); });
+    std::cout << riskRunner.toString() << "\n\n";
+
+
+    // --- 4. Cycle-accurate benchmark ---
+    // TscClock reads the CPU Time Stamp Counter: cycles plus calibrated nanoseconds.
+    // Use it for short code paths where the chrono clock resolution and call cost dominate.
+    const TscCalibration& tsc = TscCalibration::instance();
+    std::cout << "TSC: " << tsc.cyclesPerNs() << " cycles/ns, invariant: "
+              << (tsc.isInvariant() ? "yes" : "no") << "\n";
+
+    RunnerConfig tscConfig;
+    tscConfig.iterations = 1000;
+
+    BenchmarkRunner notionalRunner("Single Order Notional (TSC)", tscConfig);
+    notionalRunner.run<TscClock>([&] { return orders[0].price * orders[0].quantity; });
+    std::cout << notionalRunner.toString() << "\n\n";
+
+    // --- 5. Scoped benchmarks under multithreaded load ---
+    // Every thread writes into its own lock-free buffer, so instrumented scopes
+    // do not serialize the threads on a lock or on std::cout.
+    std::cout << "Pricing orders on 4 threads with per-order scoped benchmarks...\n";
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&orders, t] {
+            double sum = 0.0;
+            for (std::size_t i = static_cast<std::size_t>(t); i < orders.size(); i += 4) {
+                benchmark("Order Notional");
+                sum += orders[i].price * orders[i].quantity;
+                doNotOptimize(sum);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // --- 6. Hierarchical profile of the order-processing path ---
+    // Nested scopes build a call tree: calls, inclusive and exclusive time per path
+    // (this target is built with BENCHMARK_CALL_TREE, see CMakeLists.txt).
+    std::vector<Order> smallBatch(orders.begin(), orders.begin() + 2000);
+    double exposure = processOrders(smallBatch);
+    doNotOptimize(exposure);
+
+    std::cout << ScopeProfiler::instance().treeReport() << "\n";
+
+    // flamegraph.pl profile.folded > profile.svg   |   open profile.trace.json in ui.perfetto.dev
+    std::ofstream folded("profile.folded");
+    ScopeProfiler::instance().writeCollapsedStacks(folded);
+    std::ofstream trace("profile.trace.json");
+    ScopeProfiler::instance().writeChromeTrace(trace);
+    std::cout << "Wrote profile.folded and profile.trace.json\n\n";
+
+    // On-demand report; it is also printed automatically at exit.
+    SampleCollector::instance().setReportAtExit(false);
+    std::cout << SampleCollector::instance().report() << "\n";
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include "benchmark/Registry.h"
+#include "OrderBatch.h"
+#include "ParallelRisk.h"
+#include "RiskFixtures.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Scaling of the parallel portfolio risk from 1 to N threads, and a check that
+// every thread count produces the bit-identical result. The timings come from the
+// registered riskParallel case (risk_cases.cpp).
+//
+// Usage: parallel_risk_benchmark [orders] [max threads]   default: 50000000, all cores
+
+namespace {
+
+std::uint64_t bitsOf(double value) {
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : 50'000'000;
+    std::size_t maxThreads = argc > 2 ? static_cast<std::size_t>(std::strtoull(argv[2], nullptr, 10))
+                                      : std::thread::hardware_concurrency();
+    if (maxThreads == 0) {
+        maxThreads = 1;
+    }
+
+    std::cout << "Kernel: " << riskKernelIsaName(bestRiskKernel())
+              << ", " << count << " orders, chunk size " << kRiskChunkSize
+              << ", hardware threads " << std::thread::hardware_concurrency() << "\n\n";
+
+    RegistryOptions options;
+    options.filter = "^riskParallel/";
+    options.runner = riskRunnerConfig();
+    BenchmarkParam threadCounts{"threads", {}};
+    for (std::size_t threads = 1; threads <= maxThreads; ++threads) {
+        threadCounts.values.push_back(static_cast<std::int64_t>(threads));
+    }
+    options.overrides = {BenchmarkParam{"orders", {static_cast<std::int64_t>(count)}}, threadCounts};
+    const std::vector<BenchmarkResult> results = BenchmarkRegistry::instance().run(options);
+
+    std::cout << "  " << std::setw(8) << "Threads"
+              << std::setw(12) << "Median ms"
+              << std::setw(12) << "±95% ms"
+              << std::setw(14) << "Morders/s"
+              << std::setw(11) << "Speedup"
+              << std::setw(12) << "Efficiency"
+              << "   Risk (bits)\n";
+
+    // The risk values, computed once more outside the timed runs.
+    const OrderBatch batch = makeOrderBatch(count);
+    double baselineMedian = 0.0;
+    std::uint64_t baselineBits = 0;
+    bool identical = true;
+
+    for (const BenchmarkResult& result : results) {
+        const auto threads = static_cast<std::size_t>(result.params.back().second);
+        ThreadPool pool(threads);
+        const double risk = calculatePortfolioRiskParallel(batch, pool);
+        const BenchmarkStats& stats = result.stats;
+
+        if (threads == 1) {
+            baselineMedian = stats.median;
+            baselineBits = bitsOf(risk);
+        } else if (bitsOf(risk) != baselineBits) {
+            identical = false;
+        }
+
+        const double speedup = baselineMedian / stats.median;
+        std::cout << "  " << std::setw(8) << threads
+                  << std::fixed << std::setprecision(3)
+                  << std::setw(12) << stats.median / 1e6
+                  << std::setw(12) << stats.ciHalfWidth / 1e6
+                  << std::setw(14) << std::setprecision(1) << static_cast<double>(count) / stats.median * 1e3
+                  << std::setw(10) << std::setprecision(2) << speedup << "x"
+                  << std::setw(11) << std::setprecision(0) << 100.0 * speedup / static_cast<double>(threads) << "%"
+                  << "   " << std::setprecision(12) << risk
+                  << " (0x" << std::hex << bitsOf(risk) << std::dec << ")\n";
+    }
+
+    std::cout << "\nResults across thread counts: " << (identical ? "bit-identical" : "DIFFERENT") << "\n";
+    return identical ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+#include "benchmark/Registry.h"
+#include "OrderBatch.h"
+#include "RiskFixtures.h"
+#include "RiskKernels.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Compares the original array-of-structures risk loop with the struct-of-arrays
+// kernels (scalar, AVX2, AVX-512) at several portfolio sizes. The timings come from
+// the registered riskAoS/riskSoA cases (risk_cases.cpp); this report adds the
+// speedups and checks that the kernels agree.
+//
+// Usage: risk_benchmark [orders...]      default: 50000 1000000 50000000
+
+namespace {
+
+std::int64_t paramOf(const BenchmarkResult& result, const std::string& name) {
+    for (const auto& [param, value] : result.params) {
+        if (param == name) {
+            return value;
+        }
+    }
+    return -1;
+}
+
+void printRow(const std::string& label, const BenchmarkStats& stats, std::size_t orders,
+              double baselineMedian, double risk) {
+    const double medianMs = stats.median / 1e6;
+    const double ordersPerSecond = static_cast<double>(orders) / (stats.median / 1e9);
+    std::cout << "  " << std::left << std::setw(14) << label << std::right
+              << std::fixed << std::setprecision(3)
+              << std::setw(12) << medianMs
+              << std::setw(12) << stats.ciHalfWidth / 1e6
+              << std::setw(14) << std::setprecision(1) << ordersPerSecond / 1e6
+              << std::setw(10) << std::setprecision(2) << baselineMedian / stats.median << "x"
+              << "   " << std::setprecision(12) << risk << "\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<std::int64_t> sizes;
+    for (int i = 1; i < argc; ++i) {
+        sizes.push_back(std::strtoll(argv[i], nullptr, 10));
+    }
+    if (sizes.empty()) {
+        sizes = {50'000, 1'000'000, 50'000'000};
+    }
+
+    std::cout << "Best kernel on this CPU: " << riskKernelIsaName(bestRiskKernel()) << "\n\n";
+
+    RegistryOptions options;
+    options.filter = "^risk(AoS|SoA)/";
+    options.runner = riskRunnerConfig();
+    options.overrides = {BenchmarkParam{"orders", sizes}};
+    const std::vector<BenchmarkResult> results = BenchmarkRegistry::instance().run(options);
+
+    for (std::int64_t size : sizes) {
+        const auto count = static_cast<std::size_t>(size);
+        std::cout << "--- " << count << " orders ---\n"
+                  << "  " << std::left << std::setw(14) << "Layout" << std::right
+                  << std::setw(12) << "Median ms"
+                  << std::setw(12) << "±95% ms"
+                  << std::setw(14) << "Morders/s"
+                  << std::setw(11) << "Speedup"
+                  << "   Risk\n";
+
+        // The risk values, computed once more outside the timed runs.
+        const std::vector<Order> orders = makeOrders(count);
+        const OrderBatch batch(orders);
+        const double aosRisk = calculatePortfolioRisk(orders);
+
+        double aosMedian = 0.0;
+        for (const BenchmarkResult& result : results) {
+            if (result.caseName == "riskAoS" && paramOf(result, "orders") == size) {
+                aosMedian = result.stats.median;
+                printRow("AoS", result.stats, count, aosMedian, aosRisk);
+            }
+        }
+
+        const double scalarRisk = calculatePortfolioRisk(batch, RiskKernelIsa::Scalar);
+        for (const BenchmarkResult& result : results) {
+            if (result.caseName != "riskSoA" || paramOf(result, "orders") != size) {
+                continue;
+            }
+            const auto isa = static_cast<RiskKernelIsa>(paramOf(result, "isa"));
+            const double risk = calculatePortfolioRisk(batch, isa);
+            printRow(std::string("SoA ") + riskKernelIsaName(isa), result.stats, count, aosMedian, risk);
+            if (risk != scalarRisk) {
+                std::cout << "  WARNING: " << riskKernelIsaName(isa) << " result differs from scalar\n";
+            }
+        }
+        std::cout << "  Relative difference SoA vs AoS: " << std::scientific << std::setprecision(2)
+                  << std::abs(scalarRisk - aosRisk) / std::abs(aosRisk) << "\n\n";
+    }
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include "benchmark/Registry.h"
+#include "OrderBatch.h"
+#include "ParallelRisk.h"
+#include "RiskFixtures.h"
+#include "RiskKernels.h"
+#include <vector>
+
+// Portfolio risk kernels registered for benchmark_runner, risk_benchmark and
+// parallel_risk_benchmark.
+
+namespace {
+
+std::size_t orderCount(const BenchmarkState& state) {
+    return static_cast<std::size_t>(state.param("orders"));
+}
+
+void riskAoS(BenchmarkState& state) {
+    const std::vector<Order> orders = makeOrders(orderCount(state));
+    state.setItemsPerIteration(orders.size());
+    state.setBytesPerIteration(orders.size() * sizeof(Order));
+    state.run([&] { return calculatePortfolioRisk(orders); });
+}
+
+// "isa" is a RiskKernelIsa value; kernels the CPU does not support are skipped.
+void riskSoA(BenchmarkState& state) {
+    const auto isa = static_cast<RiskKernelIsa>(state.param("isa"));
+    if (!isRiskKernelSupported(isa)) {
+        return;
+    }
+    const OrderBatch batch = makeOrderBatch(orderCount(state));
+    state.setItemsPerIteration(batch.size());
+    state.setBytesPerIteration(batch.size() * (sizeof(double) + sizeof(std::int32_t)));
+    state.run([&] { return calculatePortfolioRisk(batch, isa); });
+}
+
+void riskParallel(BenchmarkState& state) {
+    const OrderBatch batch = makeOrderBatch(orderCount(state));
+    ThreadPool pool(static_cast<std::size_t>(state.param("threads")));
+    state.setItemsPerIteration(batch.size());
+    state.setBytesPerIteration(batch.size() * (sizeof(double) + sizeof(std::int32_t)));
+    state.run([&] { return calculatePortfolioRiskParallel(batch, pool); });
+}
+
+} // namespace
+
+BENCHMARK_REGISTER(riskAoS).range("orders", 1'000, 10'000'000);
+BENCHMARK_REGISTER(riskSoA).range("orders", 1'000, 10'000'000).values("isa", {
+    static_cast<std::int64_t>(RiskKernelIsa::Scalar),
+    static_cast<std::int64_t>(RiskKernelIsa::Avx2),
+    static_cast<std::int64_t>(RiskKernelIsa::Avx512)});
+BENCHMARK_REGISTER(riskParallel).range("orders", 100'000, 10'000'000).values("threads", {1, 2, 4, 8});
@@ -1,44 +1,48 @@
 #include <iostream>
-#include <x86intrin.h>
-#include <cstdint> 
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include "rdtsc_harness.h"
 
 /**
  * __rdtsc(), __rdtscp() - return unsigned 64-bit value of the current CPU TSC - Time Stamp Counter
+ * See rdtsc_harness.h for the serialized start/end reads and overhead calibration.
+ *
+ * Usage: rdtsc_benchmarking [core] [samples]      default: core 0, 10000 samples
  */
 
-inline uint64_t rdtsc_start() {
-    // cpuid guarantees serialization - all instructions are finished before executing cpuid
-    // and no new instructions are executed.
-    // It is important to use cpuid before rdtscp, otherwise __rdtsc() can be reordered by the compiler or CPU
-    unsigned int dummy;
-    __asm__ __volatile__("cpuid" : "=a"(dummy) : "a"(0) : "ebx", "ecx", "edx");
-    return __rdtsc();
-}
-
-inline uint64_t rdtsc_end() {
-    // __rdtscp - newer version of rdtsc available with  Intel Nehalem / AMD K10.
-    // __rdtscp guarantees serialization - all instructions are finished before executing __rdtscp
-    // cpuid is needed to prevent instructions execution after __rdtscp before __rdtscp is finished
-    // __rdtscp only guarantees that all instuctions will be finsihed before it execution, but it not guarantee that no instructions will called after it
-    unsigned int dummy;
-    uint64_t r = __rdtscp(&dummy);
-    __asm__ __volatile__("cpuid" : "=a"(dummy) : "a"(0) : "ebx", "ecx", "edx");
-    return r;
-}
-
 void func_to_benchmark() {
     volatile int x = 0;
     for (int i = 0; i < 1000; ++i)
         x += i;
 }
 
-int main() {
-    uint64_t start = rdtsc_start();
-
-    func_to_benchmark();
-
-    uint64_t end = rdtsc_end();
-
-    std::cout << "CPU cycles: " << (end - start) << std::endl;
+int main(int argc, char* argv[]) {
+    const int core = argc > 1 ? std::atoi(argv[1]) : 0;
+    const size_t samples = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10000;
+
+    std::string error;
+    if (pin_to_core(core, error)) {
+        std::cout << "Pinned to core " << core << std::endl;
+    } else {
+        std::cout << "Warning: " << error << ", samples may migrate between cores" << std::endl;
+    }
+
+    for (const std::string& warning : frequency_scaling_warnings(core)) {
+        std::cout << "Warning: " << warning << std::endl;
+    }
+
+    // Warm up caches, branch predictors and the core clock before calibrating.
+    measure_cycles(func_to_benchmark, samples / 10 + 1, 0);
+
+    const uint64_t overhead = measure_overhead();
+    const cycle_stats stats = measure_cycles(func_to_benchmark, samples, overhead);
+
+    std::cout << "Measurement overhead: " << stats.overhead << " cycles (subtracted)\n"
+              << "Samples: " << stats.samples << " kept, " << stats.migrated << " discarded (core migration)\n"
+              << "CPU cycles: min " << stats.min
+              << ", median " << stats.median
+              << ", p99 " << stats.p99
+              << ", max " << stats.max << std::endl;
     return 0;
 }
@@ -0,0 +1,192 @@
+#ifndef RDTSC_HARNESS_H
+#define RDTSC_HARNESS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <x86intrin.h>
+#include <cpuid.h>
+
+#ifdef __linux__
+    #include <sched.h>
+#endif
+
+/**
+ * Cycle-accurate measurement of small code regions with rdtsc/rdtscp.
+ *
+ * Raw `end - start` includes the cost of the serializing instructions themselves
+ * (cpuid alone is 100+ cycles, more under a hypervisor). The harness measures that
+ * overhead on an empty region once and subtracts it, pins the thread to one core,
+ * and drops samples during which the thread migrated to another core - TSCs of
+ * different cores are not guaranteed to be in sync, and a migration means the
+ * sample also contains the scheduler.
+ *
+ * Note: with an invariant TSC (every CPU since Nehalem) the counter ticks at the
+ * nominal frequency, not the current core frequency. Counts are only "core cycles"
+ * when the core runs at nominal speed - hence the frequency scaling warnings.
+ *
+ * The invariant-TSC check and the overhead calibration mirror TscCalibration in
+ * 10-micro-benchmarking (include/benchmark/Clock.cpp). They are repeated on purpose:
+ * every example directory is a standalone CMake project, and this one is a single
+ * header with no library to link. Keep the two in step when changing either.
+ */
+
+struct tsc_stamp {
+    uint64_t tsc;
+    uint32_t aux;   // IA32_TSC_AUX, set by Linux to (numa node << 12) | cpu
+};
+
+inline uint32_t cpu_from_aux(uint32_t aux) {
+    return aux & 0xfff;
+}
+
+inline tsc_stamp rdtsc_start() {
+    // cpuid: all previous instructions have finished.
+    // rdtscp instead of rdtsc to also read TSC_AUX (the core we are on);
+    // lfence: the measured code does not start before the counter is read.
+    unsigned int dummy;
+    __asm__ __volatile__("cpuid" : "=a"(dummy) : "a"(0) : "ebx", "ecx", "edx");
+    tsc_stamp stamp;
+    stamp.tsc = __rdtscp(&stamp.aux);
+    _mm_lfence();
+    return stamp;
+}
+
+inline tsc_stamp rdtsc_end() {
+    // rdtscp waits for the measured code to finish;
+    // cpuid keeps the following instructions from starting before the counter is read.
+    tsc_stamp stamp;
+    stamp.tsc = __rdtscp(&stamp.aux);
+    unsigned int dummy;
+    __asm__ __volatile__("cpuid" : "=a"(dummy) : "a"(0) : "ebx", "ecx", "edx");
+    return stamp;
+}
+
+/**
+ * Pins the calling thread to `core`. Returns false (and the reason in `error`)
+ * if the core does not exist or is not in the allowed set.
+ */
+inline bool pin_to_core(int core, std::string& error) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        error = "sched_setaffinity failed for core " + std::to_string(core);
+        return false;
+    }
+    return true;
+#else
+    (void)core;
+    error = "thread pinning is only implemented for Linux";
+    return false;
+#endif
+}
+
+/**
+ * Cost of rdtsc_start() + rdtsc_end() around an empty region, in TSC ticks.
+ * The minimum is used: it is the cost without interrupts or cache misses,
+ * which is what is also contained in every real sample.
+ */
+inline uint64_t measure_overhead(int rounds = 10000) {
+    uint64_t best = UINT64_MAX;
+    for (int i = 0; i < rounds; ++i) {
+        const tsc_stamp start = rdtsc_start();
+        const tsc_stamp end = rdtsc_end();
+        if (start.aux == end.aux) {
+            best = std::min(best, end.tsc - start.tsc);
+        }
+    }
+    return best == UINT64_MAX ? 0 : best;
+}
+
+struct cycle_stats {
+    uint64_t overhead = 0;      // subtracted from every sample
+    uint64_t min = 0;
+    uint64_t median = 0;
+    uint64_t p99 = 0;
+    uint64_t max = 0;
+    size_t samples = 0;         // kept samples
+    size_t migrated = 0;        // samples dropped because the core changed
+};
+
+/**
+ * Runs `func` `samples` times and returns overhead-corrected cycle statistics.
+ */
+template <typename Func>
+cycle_stats measure_cycles(Func&& func, size_t samples, uint64_t overhead) {
+    std::vector<uint64_t> cycles;
+    cycles.reserve(samples);
+    cycle_stats stats;
+    stats.overhead = overhead;
+
+    for (size_t i = 0; i < samples; ++i) {
+        const tsc_stamp start = rdtsc_start();
+        func();
+        const tsc_stamp end = rdtsc_end();
+
+        if (start.aux != end.aux) {
+            ++stats.migrated;
+            continue;
+        }
+        const uint64_t raw = end.tsc - start.tsc;
+        cycles.push_back(raw > overhead ? raw - overhead : 0);
+    }
+
+    stats.samples = cycles.size();
+    if (cycles.empty()) {
+        return stats;
+    }
+    std::sort(cycles.begin(), cycles.end());
+    stats.min = cycles.front();
+    stats.median = cycles[cycles.size() / 2];
+    stats.p99 = cycles[std::min(cycles.size() - 1, cycles.size() * 99 / 100)];
+    stats.max = cycles.back();
+    return stats;
+}
+
+inline bool tsc_is_invariant() {
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) == 0 || eax < 0x80000007) {
+        return false;
+    }
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+    return (edx >> 8) & 1u;
+}
+
+inline bool read_sysfs(const std::string& path, std::string& value) {
+    std::ifstream file(path);
+    return static_cast<bool>(std::getline(file, value));
+}
+
+/**
+ * Reasons why TSC ticks may not match core cycles on `core`.
+ * Empty when the cpufreq governor is "performance" and turbo is off.
+ */
+inline std::vector<std::string> frequency_scaling_warnings(int core) {
+    std::vector<std::string> warnings;
+    if (!tsc_is_invariant()) {
+        warnings.push_back("TSC is not invariant: its rate changes with the core frequency");
+    }
+
+    const std::string cpufreq = "/sys/devices/system/cpu/cpu" + std::to_string(core) + "/cpufreq/";
+    std::string value;
+    if (read_sysfs(cpufreq + "scaling_governor", value)) {
+        if (value != "performance") {
+            warnings.push_back("scaling governor is '" + value + "', set it to 'performance'");
+        }
+    } else {
+        warnings.push_back("frequency scaling state unknown (no cpufreq in sysfs, e.g. a VM)");
+    }
+
+    if (read_sysfs("/sys/devices/system/cpu/intel_pstate/no_turbo", value) && value == "0") {
+        warnings.push_back("turbo boost is enabled (intel_pstate/no_turbo = 0)");
+    } else if (read_sysfs("/sys/devices/system/cpu/cpufreq/boost", value) && value == "1") {
+        warnings.push_back("turbo boost is enabled (cpufreq/boost = 1)");
+    }
+    return warnings;
+}
+
+#endif // RDTSC_HARNESS_H
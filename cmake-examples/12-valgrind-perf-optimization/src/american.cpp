@@ -0,0 +1,54 @@
+// src/american.cpp
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include "pricer/black_scholes.h"
+#include "pricer/lsm_engine.h"
+#include "pricer/memory_usage.h"
+
+// Usage: option_pricer_american [num_simulations] [num_steps] [exercise_dates]
+//        default: 200000 paths, 250 steps, 50 exercise dates
+//
+// BAD: naive.cpp keeps every path in its own std::vector<double>: one allocation per
+// path, and 1M paths x 250 steps would need 2 GB plus allocator overhead.
+// GOOD: one time-major matrix that holds only the exercise dates, optionally in float.
+int main(int argc, char* argv[]) {
+    // The American put of Longstaff and Schwartz (2001), table 1, first row.
+    OptionData data;
+    data.initial_price = 36.0;
+    data.strike_price = 40.0;
+    data.risk_free_rate = 0.06;
+    data.volatility = 0.20;
+    data.time_to_maturity = 1.0;
+    data.num_simulations = argc > 1 ? std::atoi(argv[1]) : 200000;
+    data.num_steps = argc > 2 ? std::atoi(argv[2]) : 250;
+    data.style = OptionStyle::EuropeanPut;
+
+    LsmConfig config;
+    config.exercise_dates = argc > 3 ? std::atoi(argv[3]) : 50;
+
+    std::cout << "American Implementation" << std::endl;
+    std::cout << "----------------------" << std::endl;
+    std::cout << data.num_simulations << " paths x " << data.num_steps << " steps, "
+              << config.exercise_dates << " exercise dates" << std::endl;
+
+    const int tree_steps = config.exercise_dates * 100;
+    std::cout << std::fixed << std::setprecision(4)
+              << "European (Black-Scholes): " << black_scholes_put(data) << std::endl
+              << "Bermudan (binomial tree): " << binomial_tree_price(data, tree_steps, 100) << std::endl
+              << "American (binomial tree): " << binomial_tree_price(data, tree_steps, 1) << std::endl;
+
+    for (bool single_precision : {false, true}) {
+        config.single_precision = single_precision;
+        const LsmResult result = run_monte_carlo_lsm(data, config);
+        const double path_steps = static_cast<double>(result.paths) * data.num_steps;
+        std::cout << "Longstaff-Schwartz (" << (single_precision ? "float " : "double") << "): "
+                  << std::setprecision(4) << result.price << " +/- " << result.std_error
+                  << ", paths " << std::setprecision(1) << result.path_bytes / 1048576.0 << " MB"
+                  << ", simulation " << result.simulation_seconds * 1e3 << " ms ("
+                  << path_steps / result.simulation_seconds / 1e6 << " M path-steps/s)"
+                  << ", regression " << result.regression_seconds * 1e3 << " ms" << std::endl;
+    }
+    std::cout << "Peak memory (VmHWM): " << std::setprecision(1) << peak_rss_bytes() / 1048576.0 << " MB" << std::endl;
+    return 0;
+}
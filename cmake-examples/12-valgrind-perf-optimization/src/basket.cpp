@@ -0,0 +1,140 @@
+// src/basket.cpp
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include <algorithm>
+#include "pricer/basket_engine.h"
+#include "pricer/black_scholes.h"
+
+// Usage: option_pricer_basket [num_simulations] [reference_simulations]
+//        default: 200000 paths, 20000 reference paths
+//
+// GOOD: the correlation matrix is factored once, and the normals of 64 paths are
+// correlated together by a small register-blocked matrix product, vectorized over paths.
+
+namespace {
+
+// BAD (for large baskets): one path at a time, a K x K matrix-vector loop per path,
+// std::mt19937 normals and std::exp, as option_pricer_optimized would do it.
+McResult run_basket_reference(const BasketOption& option, std::mt19937& gen, std::normal_distribution<>& dist) {
+    const std::size_t k = option.assets.size();
+    const std::vector<double> factor = cholesky_factor(option.correlation, static_cast<int>(k));
+    const double t = option.time_to_maturity;
+    std::vector<double> z(k);
+    double total_payoff = 0.0;
+    double total_payoff_sq = 0.0;
+    for (int path = 0; path < option.num_simulations; ++path) {
+        for (double& value : z) {
+            value = dist(gen);
+        }
+        double basket = 0.0;
+        for (std::size_t i = 0; i < k; ++i) {
+            double shock = 0.0;
+            for (std::size_t j = 0; j <= i; ++j) {
+                shock += factor[i * k + j] * z[j];
+            }
+            const BasketAsset& asset = option.assets[i];
+            const double terminal = asset.initial_price *
+                std::exp((option.risk_free_rate - asset.dividend_yield - 0.5 * asset.volatility * asset.volatility) * t +
+                         asset.volatility * std::sqrt(t) * shock);
+            basket += asset.weight * terminal;
+        }
+        const double payoff = std::max(basket - option.strike_price, 0.0);
+        total_payoff += payoff;
+        total_payoff_sq += payoff * payoff;
+    }
+    const double n = option.num_simulations;
+    const double discount = std::exp(-option.risk_free_rate * t);
+    const double mean = total_payoff / n;
+    McResult result;
+    result.price = discount * mean;
+    result.std_error = discount * std::sqrt((total_payoff_sq / n - mean * mean) / (n - 1.0));
+    result.paths = option.num_simulations;
+    return result;
+}
+
+// Equally weighted basket of `k` assets with pairwise correlation `rho`.
+BasketOption make_basket(int k, double rho, int num_simulations) {
+    BasketOption option;
+    for (int i = 0; i < k; ++i) {
+        option.assets.push_back(BasketAsset{100.0, 0.15 + 0.1 * i / std::max(1, k - 1), 0.01, 1.0 / k});
+    }
+    option.correlation.assign(static_cast<std::size_t>(k * k), rho);
+    for (int i = 0; i < k; ++i) {
+        option.correlation[static_cast<std::size_t>(i * k + i)] = 1.0;
+    }
+    option.strike_price = 100.0;
+    option.risk_free_rate = 0.05;
+    option.time_to_maturity = 1.0;
+    option.num_simulations = num_simulations;
+    return option;
+}
+
+double elapsed_ms(std::chrono::high_resolution_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const int num_simulations = argc > 1 ? std::atoi(argv[1]) : 200000;
+    const int reference_simulations = argc > 2 ? std::atoi(argv[2]) : 20000;
+
+    std::cout << "Basket Implementation" << std::endl;
+    std::cout << "----------------------" << std::endl;
+    std::cout << num_simulations << " paths, " << simd_isa_name(best_simd_isa()) << ", 1 thread" << std::endl;
+
+    // One asset: the basket call is a vanilla call.
+    BasketOption single = make_basket(1, 0.0, num_simulations);
+    single.assets[0].dividend_yield = 0.0;
+    OptionData vanilla{100.0, 100.0, 0.05, 0.15, 1.0, 0, 1};
+    const McResult single_result = run_monte_carlo_basket(single, 42, 1);
+    std::cout << "K = 1: " << std::fixed << std::setprecision(4) << single_result.price << " +/- "
+              << single_result.std_error << ", Black-Scholes " << black_scholes_call(vanilla) << std::endl;
+
+    std::cout << "Basket call, pairwise correlation 0.5:" << std::endl
+              << std::setw(5) << "K" << std::setw(20) << "price" << std::setw(12) << "ms"
+              << std::setw(14) << "paths/s" << std::setw(14) << "ns/asset" << std::setw(16) << "loop ns/asset"
+              << std::setw(10) << "speedup" << std::setw(8) << "z" << std::endl;
+    for (int k : {1, 2, 5, 10, 20, 50}) {
+        BasketOption option = make_basket(k, 0.5, num_simulations);
+        auto start = std::chrono::high_resolution_clock::now();
+        const McResult result = run_monte_carlo_basket(option, 42, 1);
+        const double ms = elapsed_ms(start);
+        const double ns_per_asset = ms * 1e6 / (static_cast<double>(num_simulations) * k);
+
+        option.num_simulations = reference_simulations;
+        std::mt19937 gen(12345);
+        std::normal_distribution<> dist(0.0, 1.0);
+        start = std::chrono::high_resolution_clock::now();
+        const McResult reference = run_basket_reference(option, gen, dist);
+        const double reference_ns = elapsed_ms(start) * 1e6 / (static_cast<double>(reference_simulations) * k);
+        const double z = (result.price - reference.price) /
+                         std::sqrt(result.std_error * result.std_error + reference.std_error * reference.std_error);
+
+        std::cout << std::setw(5) << k << std::setprecision(4) << std::setw(11) << result.price << " +/- "
+                  << result.std_error << std::setprecision(1) << std::setw(12) << ms
+                  << std::setprecision(0) << std::setw(14) << num_simulations / (ms / 1e3)
+                  << std::setprecision(2) << std::setw(14) << ns_per_asset << std::setw(16) << reference_ns
+                  << std::setprecision(1) << std::setw(9) << reference_ns / ns_per_asset << "x"
+                  << std::setprecision(2) << std::setw(8) << z << std::endl;
+    }
+
+    std::cout << "Rainbow options on 5 assets (weights 1):" << std::endl;
+    BasketOption rainbow = make_basket(5, 0.5, num_simulations);
+    for (BasketAsset& asset : rainbow.assets) {
+        asset.weight = 1.0;
+    }
+    for (auto [name, kind] : {std::pair{"best-of call", BasketPayoffKind::BestOfCall},
+                              std::pair{"worst-of call", BasketPayoffKind::WorstOfCall}}) {
+        rainbow.payoff = kind;
+        const McResult result = run_monte_carlo_basket(rainbow, 42, 1);
+        std::cout << "  " << std::left << std::setw(14) << name << std::right << std::setprecision(4)
+                  << result.price << " +/- " << result.std_error << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,222 @@
+// src/bench.cpp
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+#include "pricer/adaptive_engine.h"
+#include "pricer/basket_engine.h"
+#include "pricer/black_scholes.h"
+#include "pricer/greeks_engine.h"
+#include "pricer/lsm_engine.h"
+#include "pricer/memory_usage.h"
+#include "pricer/parallel_engine.h"
+#include "pricer/qmc_engine.h"
+#include "pricer/reference_engine.h"
+#include "pricer/simd_engine.h"
+
+// Usage: option_pricer_bench [quick|full] > results.csv
+//        quick (default): 10000 and 100000 paths; full adds 1000000
+//
+// Runs every engine over a grid of simulations x steps x threads and prints one CSV
+// row per point: throughput, cost per path-step, error against the analytic price and
+// peak memory. Progress and skipped points go to stderr.
+
+namespace {
+
+constexpr std::uint64_t kSeed = 42;
+constexpr double kMinSeconds = 0.2;   // repeat short runs until they take this long...
+constexpr int kMaxRuns = 5;           // ...but at most this often, and keep the fastest
+
+struct Engine {
+    const char* name;
+    bool multithreaded;
+    double max_path_steps;   // larger points are skipped: the engine would take minutes
+    McResult (*run)(const OptionData& data, unsigned threads);
+    double (*analytic)(const OptionData& data);
+};
+
+McResult run_adaptive(const OptionData& data, unsigned threads) {
+    // No target: run exactly num_simulations paths, half of them antithetic.
+    AdaptiveConfig config;
+    config.target_std_error = 0.0;
+    config.max_samples = data.num_simulations / 2;
+    config.seed = kSeed;
+    config.num_threads = threads;
+    const AdaptiveResult result = run_monte_carlo_adaptive(data, config);
+    return McResult{result.price, result.std_error, result.paths};
+}
+
+McResult run_qmc(const OptionData& data, unsigned threads) {
+    QmcConfig config;
+    config.seed = kSeed;
+    config.num_threads = threads;
+    return run_monte_carlo_qmc(data, config);
+}
+
+McResult run_lsm(const OptionData& data, unsigned threads, bool single_precision) {
+    // Without dividends the American call is worth the European one, so the
+    // Black-Scholes price is the reference; every step is an exercise date.
+    LsmConfig config;
+    config.single_precision = single_precision;
+    config.seed = kSeed;
+    config.num_threads = threads;
+    const LsmResult result = run_monte_carlo_lsm(data, config);
+    return McResult{result.price, result.std_error, result.paths};
+}
+
+McResult run_basket(const OptionData& data, unsigned threads) {
+    // One asset: the basket kernel on a plain European call.
+    BasketOption option;
+    option.assets = {BasketAsset{data.initial_price, data.volatility, 0.0, 1.0}};
+    option.correlation = {1.0};
+    option.strike_price = data.strike_price;
+    option.risk_free_rate = data.risk_free_rate;
+    option.time_to_maturity = data.time_to_maturity;
+    option.num_simulations = data.num_simulations;
+    option.num_steps = data.num_steps;
+    return run_monte_carlo_basket(option, kSeed, threads);
+}
+
+constexpr double kUnlimited = std::numeric_limits<double>::infinity();
+
+const Engine kEngines[] = {
+    {"naive", false, 6e5,
+     [](const OptionData& data, unsigned) { return run_monte_carlo_naive(data); }, black_scholes_call},
+    {"sequential", false, 1e8,
+     [](const OptionData& data, unsigned) { return run_monte_carlo_sequential(data, kSeed); }, black_scholes_call},
+    {"parallel", true, 3e8,
+     [](const OptionData& data, unsigned threads) { return run_monte_carlo_parallel(data, kSeed, threads); },
+     black_scholes_call},
+    {"simd-scalar", true, kUnlimited,
+     [](const OptionData& data, unsigned threads) { return run_monte_carlo_simd(data, kSeed, threads, SimdIsa::Scalar); },
+     black_scholes_call},
+    {"simd-avx2", true, kUnlimited,
+     [](const OptionData& data, unsigned threads) { return run_monte_carlo_simd(data, kSeed, threads, SimdIsa::Avx2); },
+     black_scholes_call},
+    {"simd-avx512", true, kUnlimited,
+     [](const OptionData& data, unsigned threads) { return run_monte_carlo_simd(data, kSeed, threads, SimdIsa::Avx512); },
+     black_scholes_call},
+    {"adaptive", true, kUnlimited, run_adaptive, black_scholes_call},
+    {"qmc", true, kUnlimited, run_qmc, black_scholes_call},
+    {"greeks", true, kUnlimited,
+     [](const OptionData& data, unsigned threads) {
+         const McGreeks greeks = run_monte_carlo_greeks(data, kSeed, threads);
+         return McResult{greeks.price.value, greeks.price.std_error, greeks.paths};
+     },
+     black_scholes_call},
+    {"exotic-geometric-asian", true, kUnlimited,
+     [](const OptionData& data, unsigned threads) {
+         return run_monte_carlo_exotic(data, PathPayoff{PathPayoffKind::GeometricAsian}, kSeed, threads);
+     },
+     [](const OptionData& data) { return geometric_asian_price(data, true); }},
+    {"basket-1-asset", true, kUnlimited, run_basket, black_scholes_call},
+    {"lsm-double", true, 3e8,
+     [](const OptionData& data, unsigned threads) { return run_lsm(data, threads, false); }, black_scholes_call},
+    {"lsm-float", true, 3e8,
+     [](const OptionData& data, unsigned threads) { return run_lsm(data, threads, true); }, black_scholes_call},
+};
+
+// 1, 2, 4, ... up to the number of cores, and the number of cores itself.
+std::vector<unsigned> thread_counts() {
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> counts;
+    for (unsigned threads = 1; threads < cores; threads *= 2) {
+        counts.push_back(threads);
+    }
+    counts.push_back(cores);
+    return counts;
+}
+
+bool engine_supported(const Engine& engine) {
+    const std::string name = engine.name;
+    if (name == "simd-avx2") {
+        return is_simd_isa_supported(SimdIsa::Avx2);
+    }
+    if (name == "simd-avx512") {
+        return is_simd_isa_supported(SimdIsa::Avx512);
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::string grid = argc > 1 ? argv[1] : "quick";
+    if (grid != "quick" && grid != "full") {
+        std::cerr << "usage: option_pricer_bench [quick|full]" << std::endl;
+        return 2;
+    }
+    std::vector<int> simulations = {10000, 100000};
+    if (grid == "full") {
+        simulations.push_back(1000000);
+    }
+    const std::vector<int> steps = {1, 52, 252};
+    const std::vector<unsigned> threads = thread_counts();
+
+    OptionData data;
+    data.initial_price = 100.0;
+    data.strike_price = 105.0;
+    data.risk_free_rate = 0.05;
+    data.volatility = 0.20;
+    data.time_to_maturity = 1.0;
+
+    std::cout << "engine,simulations,steps,threads,paths,seconds,paths_per_second,ns_per_path_step,"
+                 "price,std_error,analytic,error,error_in_std_errors,peak_rss_mb" << std::endl;
+    for (const Engine& engine : kEngines) {
+        if (!engine_supported(engine)) {
+            std::cerr << engine.name << ": not supported by this CPU, skipped" << std::endl;
+            continue;
+        }
+        for (int num_simulations : simulations) {
+            for (int num_steps : steps) {
+                data.num_simulations = num_simulations;
+                data.num_steps = num_steps;
+                if (static_cast<double>(num_simulations) * num_steps > engine.max_path_steps) {
+                    std::cerr << engine.name << ": " << num_simulations << " x " << num_steps
+                              << " skipped (over " << engine.max_path_steps << " path-steps)" << std::endl;
+                    continue;
+                }
+                const double analytic = engine.analytic(data);
+                for (unsigned num_threads : threads) {
+                    if (!engine.multithreaded && num_threads > 1) {
+                        break;
+                    }
+                    std::cerr << engine.name << ": " << num_simulations << " x " << num_steps
+                              << ", " << num_threads << " thread(s)" << std::endl;
+
+                    reset_peak_rss();
+                    McResult result;
+                    double seconds = std::numeric_limits<double>::infinity();
+                    double total_seconds = 0.0;
+                    for (int run = 0; run < kMaxRuns && total_seconds < kMinSeconds; ++run) {
+                        auto start = std::chrono::steady_clock::now();
+                        result = engine.run(data, num_threads);
+                        auto end = std::chrono::steady_clock::now();
+                        const double elapsed = std::chrono::duration<double>(end - start).count();
+                        seconds = std::min(seconds, elapsed);
+                        total_seconds += elapsed;
+                    }
+                    const double paths = static_cast<double>(result.paths);
+                    const double error = result.price - analytic;
+
+                    std::cout << engine.name << ',' << num_simulations << ',' << num_steps << ',' << num_threads
+                              << ',' << result.paths << ',' << std::setprecision(6) << seconds
+                              << ',' << paths / seconds
+                              << ',' << seconds * 1e9 / (paths * num_steps)
+                              << ',' << std::setprecision(10) << result.price
+                              << ',' << std::setprecision(6) << result.std_error << ',' << std::setprecision(10) << analytic
+                              << ',' << std::setprecision(6) << error
+                              << ',' << (result.std_error > 0.0 ? error / result.std_error : 0.0)
+                              << ',' << std::setprecision(4) << peak_rss_bytes() / 1048576.0 << std::endl;
+                }
+            }
+        }
+    }
+    return 0;
+}
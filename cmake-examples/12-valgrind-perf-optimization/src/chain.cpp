@@ -0,0 +1,150 @@
+// src/chain.cpp
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include <algorithm>
+#include "pricer/chain_pricer.h"
+#include "pricer/black_scholes.h"
+#include "pricer/simd_ops_scalar.h"
+#include "pricer/vector_math.h"
+
+// Usage: option_pricer_chain [num_simulations] [baseline_options]
+//        default: 20000 paths per Asian maturity, 8 options priced by the baseline loop
+//
+// A chain of 25 monthly maturities x 400 strikes (10000 options): 40% calls, 40% puts
+// and 20% arithmetic-average Asian calls with one averaging date per trading day.
+
+namespace {
+
+// BAD (as a chain pricer): the loop of option_pricer_optimized, one full simulation per option.
+double run_monte_carlo_reference(const OptionData& data, std::mt19937& gen, std::normal_distribution<>& dist) {
+    if (data.num_simulations <= 0) {
+        return 0.0;  // same as the chain pricer's empty result
+    }
+    double total_payoff = 0.0;
+    double dt = data.time_to_maturity / data.num_steps;
+    double drift = (data.risk_free_rate - 0.5 * data.volatility * data.volatility) * dt;
+    double diffusion = data.volatility * std::sqrt(dt);
+
+    for (int i = 0; i < data.num_simulations; ++i) {
+        double current_price = data.initial_price;
+        double price_sum = 0.0;
+        for (int j = 0; j < data.num_steps; ++j) {
+            current_price *= std::exp(drift + diffusion * dist(gen));
+            price_sum += current_price;
+        }
+
+        double payoff = 0.0;
+        switch (data.style) {
+            case OptionStyle::EuropeanCall: payoff = std::max(current_price - data.strike_price, 0.0); break;
+            case OptionStyle::EuropeanPut:  payoff = std::max(data.strike_price - current_price, 0.0); break;
+            case OptionStyle::ArithmeticAsianCall:
+                payoff = std::max(price_sum / data.num_steps - data.strike_price, 0.0);
+                break;
+        }
+        total_payoff += payoff;
+    }
+    return total_payoff / data.num_simulations * std::exp(-data.risk_free_rate * data.time_to_maturity);
+}
+
+// Largest relative error of the vectorized N(x) over its continued-fraction tail,
+// against erfc. Checked on the one-lane instantiation, which every vector width
+// matches bit for bit; the absolute error there is too small to show in prices.
+double max_cdf_tail_error() {
+    double max_error = 0.0;
+    for (int i = 0; i <= 29930; ++i) {
+        const double x = -37.0 + 0.001 * i;  // -37 .. -7.07
+        const double exact = 0.5 * std::erfc(-x / std::sqrt(2.0));
+        max_error = std::max(max_error, std::abs(vmath::normal_cdf<ScalarOps>(x) - exact) / exact);
+    }
+    return max_error;
+}
+
+std::vector<OptionData> make_chain(int num_simulations) {
+    constexpr int kMaturities = 25;
+    constexpr int kStrikes = 400;
+    std::vector<OptionData> chain;
+    chain.reserve(kMaturities * kStrikes);
+    for (int month = 1; month <= kMaturities; ++month) {
+        for (int k = 0; k < kStrikes; ++k) {
+            OptionData data;
+            data.initial_price = 100.0;
+            data.strike_price = 60.0 + 0.2 * k;        // 60 .. 139.8
+            data.risk_free_rate = 0.05;
+            data.volatility = 0.15 + 0.002 * month;  // a simple term structure
+            data.time_to_maturity = month / 12.0;
+            data.num_simulations = num_simulations;
+            data.num_steps = 21 * month;
+            const int kind = k % 5;
+            data.style = kind < 2 ? OptionStyle::EuropeanCall
+                       : kind < 4 ? OptionStyle::EuropeanPut
+                                  : OptionStyle::ArithmeticAsianCall;
+            chain.push_back(data);
+        }
+    }
+    return chain;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const int num_simulations = argc > 1 ? std::atoi(argv[1]) : 20000;
+    const int baseline_options = argc > 2 ? std::atoi(argv[2]) : 8;
+    const std::vector<OptionData> chain = make_chain(num_simulations);
+
+    std::cout << "Option Chain Implementation" << std::endl;
+    std::cout << "----------------------" << std::endl;
+    std::cout << chain.size() << " options, " << num_simulations << " paths per Asian maturity" << std::endl;
+
+    // GOOD: one call for the whole chain. Europeans take the vectorized closed form,
+    // the Asians of each maturity share one set of paths.
+    std::vector<McResult> results(chain.size());
+    auto start = std::chrono::high_resolution_clock::now();
+    price_option_chain(chain, results);
+    auto end = std::chrono::high_resolution_clock::now();
+    const double chain_ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+    double max_bs_error = 0.0;
+    double max_asian_se = 0.0;
+    for (std::size_t i = 0; i < chain.size(); ++i) {
+        if (chain[i].style == OptionStyle::ArithmeticAsianCall) {
+            max_asian_se = std::max(max_asian_se, results[i].std_error);
+        } else {
+            max_bs_error = std::max(max_bs_error, std::abs(results[i].price - black_scholes_price(chain[i])));
+        }
+    }
+
+    // The baseline prices a sample of the chain one option at a time and is extrapolated.
+    std::mt19937 gen(12345);
+    std::normal_distribution<> dist(0.0, 1.0);
+    const std::size_t stride = chain.size() / static_cast<std::size_t>(std::max(1, baseline_options));
+    double baseline_ms = 0.0;
+    int sampled = 0;
+    std::cout << std::fixed << std::setprecision(4);
+    for (; sampled < baseline_options; ++sampled) {
+        // + sampled walks through the call/put/Asian pattern of the strikes
+        const std::size_t i = (static_cast<std::size_t>(sampled) * stride + stride / 2 + static_cast<std::size_t>(sampled)) % chain.size();
+        start = std::chrono::high_resolution_clock::now();
+        const double price = run_monte_carlo_reference(chain[i], gen, dist);
+        end = std::chrono::high_resolution_clock::now();
+        baseline_ms += std::chrono::duration<double, std::milli>(end - start).count();
+        std::cout << "  option " << std::setw(5) << i << ": chain " << results[i].price
+                  << ", baseline loop " << price << std::endl;
+    }
+    const double baseline_chain_ms = baseline_ms / std::max(1, sampled) * static_cast<double>(chain.size());
+
+    std::cout << std::setprecision(2)
+              << "Chain pricer:  " << chain_ms << " ms (" << chain_ms * 1e3 / chain.size() << " us/option)" << std::endl
+              << "Baseline loop: " << baseline_chain_ms / 1e3 << " s estimated from " << sampled << " options"
+              << " (speedup " << std::setprecision(0) << baseline_chain_ms / chain_ms << "x)" << std::endl
+              << std::scientific << std::setprecision(2)
+              << "Max |vector BS - scalar BS|: " << max_bs_error << std::endl
+              << "Max rel error of vector N(x), x in [-37, -7.07]: " << max_cdf_tail_error() << std::endl
+              << std::fixed << std::setprecision(4)
+              << "Max Asian std error: " << max_asian_se << std::endl;
+    return 0;
+}
@@ -0,0 +1,135 @@
+// src/exotic.cpp
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#include <algorithm>
+#include "pricer/black_scholes.h"
+#include "pricer/simd_engine.h"
+
+// Usage: option_pricer_exotic [num_simulations] [reference_simulations]
+//        default: 200000 paths (x 252 steps), 20000 reference paths
+//
+// GOOD: Path-dependent payoffs keep running statistics per path (sum, log sum,
+// running min/max) in vector registers. The payoff type is a template parameter of
+// the path kernel, so the step loop is compiled once per payoff and fully inlined.
+
+namespace {
+
+// BAD: the naive way. Store every path in a vector (allocated per path), then
+// compute the arithmetic Asian payoff from it.
+McResult run_asian_reference(const OptionData& data, std::mt19937& gen, std::normal_distribution<>& dist) {
+    double total_payoff = 0.0;
+    double total_payoff_sq = 0.0;
+    double dt = data.time_to_maturity / data.num_steps;
+    double drift = (data.risk_free_rate - 0.5 * data.volatility * data.volatility) * dt;
+    double diffusion = data.volatility * std::sqrt(dt);
+
+    for (int i = 0; i < data.num_simulations; ++i) {
+        std::vector<double> path;
+        path.push_back(data.initial_price);
+        for (int j = 0; j < data.num_steps; ++j) {
+            path.push_back(path.back() * std::exp(drift + diffusion * dist(gen)));
+        }
+        double sum = 0.0;
+        for (std::size_t j = 1; j < path.size(); ++j) {
+            sum += path[j];
+        }
+        double payoff = std::max(sum / data.num_steps - data.strike_price, 0.0);
+        total_payoff += payoff;
+        total_payoff_sq += payoff * payoff;
+    }
+
+    const double n = data.num_simulations;
+    const double discount = std::exp(-data.risk_free_rate * data.time_to_maturity);
+    const double mean = total_payoff / n;
+    McResult result;
+    result.price = discount * mean;
+    result.std_error = discount * std::sqrt((total_payoff_sq / n - mean * mean) / (n - 1.0));
+    result.paths = data.num_simulations;
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    OptionData data;
+    data.initial_price = 100.0;
+    data.strike_price = 100.0;
+    data.risk_free_rate = 0.05;
+    data.volatility = 0.20;
+    data.time_to_maturity = 1.0;
+    data.num_simulations = argc > 1 ? std::atoi(argv[1]) : 200000;
+    data.num_steps = 252;
+    const int reference_simulations = argc > 2 ? std::atoi(argv[2]) : 20000;
+    const double path_steps = static_cast<double>(data.num_simulations) * data.num_steps;
+
+    std::cout << "Exotic Implementation" << std::endl;
+    std::cout << "----------------------" << std::endl;
+    std::cout << data.num_simulations << " paths x " << data.num_steps << " steps, "
+              << simd_isa_name(best_simd_isa()) << ", 1 thread" << std::endl;
+
+    OptionData reference_data = data;
+    reference_data.num_simulations = reference_simulations;
+    std::mt19937 gen(12345);
+    std::normal_distribution<> dist(0.0, 1.0);
+    auto start = std::chrono::high_resolution_clock::now();
+    const McResult reference = run_asian_reference(reference_data, gen, dist);
+    auto end = std::chrono::high_resolution_clock::now();
+    const double reference_ns = std::chrono::duration<double, std::nano>(end - start).count() /
+                                (static_cast<double>(reference_simulations) * data.num_steps);
+    std::cout << "Stored paths (mt19937), arithmetic Asian call: " << std::fixed << std::setprecision(4)
+              << reference.price << " +/- " << reference.std_error << ", " << std::setprecision(2)
+              << reference_ns << " ns/path-step" << std::endl;
+
+    struct Case {
+        const char* name;
+        PathPayoff payoff;
+    };
+    const Case cases[] = {
+        {"arithmetic Asian call", {PathPayoffKind::ArithmeticAsian, true, 0.0}},
+        {"arithmetic Asian put", {PathPayoffKind::ArithmeticAsian, false, 0.0}},
+        {"geometric Asian call", {PathPayoffKind::GeometricAsian, true, 0.0}},
+        {"geometric Asian put", {PathPayoffKind::GeometricAsian, false, 0.0}},
+        {"up-and-out call 120", {PathPayoffKind::UpAndOut, true, 120.0}},
+        {"up-and-in call 120", {PathPayoffKind::UpAndIn, true, 120.0}},
+        {"down-and-out put 85", {PathPayoffKind::DownAndOut, false, 85.0}},
+        {"down-and-in put 85", {PathPayoffKind::DownAndIn, false, 85.0}},
+        {"lookback call", {PathPayoffKind::FloatingLookback, true, 0.0}},
+        {"lookback put", {PathPayoffKind::FloatingLookback, false, 0.0}},
+    };
+
+    std::vector<McResult> results;
+    for (const Case& c : cases) {
+        start = std::chrono::high_resolution_clock::now();
+        const McResult result = run_monte_carlo_exotic(data, c.payoff, 42, 1);
+        end = std::chrono::high_resolution_clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(end - start).count() / path_steps;
+        results.push_back(result);
+
+        std::cout << "  " << std::left << std::setw(22) << c.name << std::right
+                  << std::setprecision(4) << std::setw(9) << result.price << " +/- " << result.std_error
+                  << ", " << std::setprecision(2) << std::setw(5) << ns << " ns/path-step";
+        if (c.payoff.kind == PathPayoffKind::GeometricAsian) {
+            const double analytic = geometric_asian_price(data, c.payoff.call);
+            std::cout << ", closed form " << std::setprecision(4) << analytic
+                      << " (z " << std::showpos << std::setprecision(2)
+                      << (result.price - analytic) / result.std_error << std::noshowpos << ")";
+        }
+        if (c.payoff.kind == PathPayoffKind::ArithmeticAsian && c.payoff.call) {
+            std::cout << ", " << std::setprecision(0) << reference_ns / ns << "x vs stored paths";
+        }
+        std::cout << std::endl;
+    }
+
+    // Knock-in + knock-out is the vanilla option, path by path.
+    const double vanilla_call = run_monte_carlo_simd(data, 42, 1).price;
+    std::cout << std::setprecision(6)
+              << "In + out parity: call " << results[4].price + results[5].price << " vs vanilla " << vanilla_call
+              << ", put " << results[6].price + results[7].price << " vs Black-Scholes " << black_scholes_put(data)
+              << std::defaultfloat << std::endl;
+    return 0;
+}
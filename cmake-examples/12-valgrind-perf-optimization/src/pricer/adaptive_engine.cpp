@@ -0,0 +1,84 @@
+// src/pricer/adaptive_engine.cpp
+#include "pricer/adaptive_engine.h"
+#include "pricer/parallel_engine.h"
+#include "pricer/parallel_for.h"
+#include "pricer/simd_engine.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+struct Estimate {
+    double mean = 0.0;           // undiscounted
+    double variance = 0.0;       // per sample
+    double plain_variance = 0.0; // per path, without variance reduction
+};
+
+Estimate estimate(const ControlSums& sums, double control_mean, bool use_control) {
+    Estimate result;
+    const double n = static_cast<double>(sums.samples);
+    if (sums.samples < 2) {
+        return result;
+    }
+    const double mean_y = sums.y / n;
+    const double mean_x = sums.x / n;
+    const double var_y = std::max(0.0, (sums.y_sq - n * mean_y * mean_y) / (n - 1.0));
+    const double var_x = std::max(0.0, (sums.x_sq - n * mean_x * mean_x) / (n - 1.0));
+    const double cov_xy = (sums.xy - n * mean_x * mean_y) / (n - 1.0);
+    const double mean_plain = sums.plain / n;
+    result.plain_variance = std::max(0.0, (sums.plain_sq - n * mean_plain * mean_plain) / (n - 1.0));
+
+    result.mean = mean_y;
+    result.variance = var_y;
+    if (use_control && var_x > 0.0) {
+        const double beta = cov_xy / var_x;
+        result.mean = mean_y - beta * (mean_x - control_mean);
+        result.variance = std::max(0.0, var_y - cov_xy * beta);
+    }
+    return result;
+}
+
+} // namespace
+
+AdaptiveResult run_monte_carlo_adaptive(const OptionData& data, const AdaptiveConfig& config) {
+    const SimdKernels& kernels = simd_kernels(best_simd_isa());
+    const double discount = std::exp(-data.risk_free_rate * data.time_to_maturity);
+    const double control_mean = data.initial_price * std::exp(data.risk_free_rate * data.time_to_maturity);
+    const std::int64_t paths_per_sample = config.antithetic ? 2 : 1;
+    const std::int64_t batch = std::max<std::int64_t>(config.batch_samples, kPathsPerBlock);
+
+    AdaptiveResult result;
+    ControlSums total;
+    std::vector<ControlSums> blocks;
+    while (total.samples < config.max_samples) {
+        // Sample i always uses Philox stream i, so batch b covers streams [b * batch, (b + 1) * batch).
+        const std::int64_t first_sample = total.samples;
+        const std::int64_t samples = std::min(batch, config.max_samples - first_sample);
+        const auto num_blocks = static_cast<std::size_t>((samples + kPathsPerBlock - 1) / kPathsPerBlock);
+        blocks.assign(num_blocks, ControlSums{});
+
+        parallel_for(num_blocks, config.num_threads, [&](std::size_t block) {
+            const std::int64_t offset = static_cast<std::int64_t>(block) * kPathsPerBlock;
+            blocks[block] = kernels.european_control(data, config.seed, first_sample + offset,
+                                                     std::min(kPathsPerBlock, samples - offset), config.antithetic);
+        });
+        total = total + pairwise_sum(blocks, 0, num_blocks);
+        ++result.batches;
+
+        const Estimate current = estimate(total, control_mean, config.control_variate);
+        result.price = discount * current.mean;
+        result.std_error = discount * std::sqrt(current.variance / static_cast<double>(total.samples));
+        result.paths = total.samples * paths_per_sample;
+        if (current.variance > 0.0) {
+            // paths needed by plain MC / paths used, at equal error
+            result.variance_reduction = current.plain_variance * static_cast<double>(total.samples) /
+                                        (current.variance * static_cast<double>(result.paths));
+        }
+        if (result.std_error <= config.target_std_error) {
+            result.converged = true;
+            break;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,40 @@
+// src/pricer/adaptive_engine.h
+#pragma once
+
+#include "pricer/option_data.h"
+#include <cstdint>
+
+// Settings of run_monte_carlo_adaptive(). num_simulations in OptionData is ignored:
+// the engine simulates until the standard error reaches the target.
+struct AdaptiveConfig {
+    double target_std_error = 0.01;            // absolute, in price units
+    std::int64_t batch_samples = 65536;        // samples simulated between checks
+    std::int64_t max_samples = 100'000'000;    // hard limit
+    bool antithetic = true;                    // pair every path with its mirror (-z)
+    bool control_variate = true;               // regress on the terminal price
+    std::uint64_t seed = 42;
+    unsigned num_threads = 0;                  // 0 = all cores
+};
+
+struct AdaptiveResult {
+    double price = 0.0;
+    double std_error = 0.0;
+    std::int64_t paths = 0;          // simulated paths (2 per sample with antithetic variates)
+    int batches = 0;
+    bool converged = false;          // false if max_samples stopped the run first
+    // Plain Monte Carlo would need this many times more paths for the same error.
+    double variance_reduction = 1.0;
+};
+
+// European call priced in batches until std_error <= target_std_error.
+//
+// Antithetic variates: every sample averages the payoffs of the path driven by z and
+// the one driven by -z; their errors are negatively correlated.
+// Control variate: the terminal price S_T, whose expectation S0 e^{rT} is known
+// exactly (it is the Black-Scholes value of a zero-strike call). The estimate is
+// mean(Y) - beta (mean(X) - E[X]) with beta = cov(X, Y) / var(X) estimated from
+// the same samples, which removes the part of the payoff variance explained by S_T.
+//
+// Batches are summed in a fixed order and the stopping rule only looks at those sums,
+// so the result is reproducible for a given seed at any thread count.
+AdaptiveResult run_monte_carlo_adaptive(const OptionData& data, const AdaptiveConfig& config = {});
@@ -0,0 +1,85 @@
+// src/pricer/basket_engine.cpp
+#include "pricer/basket_engine.h"
+#include "pricer/parallel_engine.h"
+#include "pricer/parallel_for.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+std::vector<double> cholesky_factor(const std::vector<double>& matrix, int n) {
+    const auto size = static_cast<std::size_t>(n);
+    if (matrix.size() != size * size) {
+        throw std::invalid_argument("cholesky_factor: expected a " + std::to_string(n) + " x " + std::to_string(n) + " matrix");
+    }
+    std::vector<double> factor(size * size, 0.0);
+    for (std::size_t i = 0; i < size; ++i) {
+        for (std::size_t j = 0; j <= i; ++j) {
+            if (std::abs(matrix[i * size + j] - matrix[j * size + i]) > 1e-12) {
+                throw std::invalid_argument("cholesky_factor: matrix is not symmetric");
+            }
+            double value = matrix[i * size + j];
+            for (std::size_t k = 0; k < j; ++k) {
+                value -= factor[i * size + k] * factor[j * size + k];
+            }
+            if (i == j) {
+                if (value <= 0.0) {
+                    throw std::invalid_argument("cholesky_factor: matrix is not positive definite");
+                }
+                factor[i * size + i] = std::sqrt(value);
+            } else {
+                factor[i * size + j] = value / factor[j * size + j];
+            }
+        }
+    }
+    return factor;
+}
+
+McResult run_monte_carlo_basket(const BasketOption& option, std::uint64_t seed, unsigned num_threads) {
+    return run_monte_carlo_basket(option, seed, num_threads, best_simd_isa());
+}
+
+McResult run_monte_carlo_basket(const BasketOption& option, std::uint64_t seed, unsigned num_threads, SimdIsa isa) {
+    const int assets = static_cast<int>(option.assets.size());
+    if (assets == 0 || assets > kMaxBasketAssets) {
+        throw std::invalid_argument("run_monte_carlo_basket: 1 to " + std::to_string(kMaxBasketAssets) + " assets");
+    }
+    const std::int64_t total_paths = option.num_simulations;
+    if (total_paths <= 0) {
+        return McResult{};
+    }
+
+    // Fold sigma_i sqrt(dt) into the rows of the factor: X = L' Z is the log-price shock.
+    const double dt = option.time_to_maturity / option.num_steps;
+    std::vector<double> factor = cholesky_factor(option.correlation, assets);
+    std::vector<double> drift(static_cast<std::size_t>(assets));
+    std::vector<double> spot(static_cast<std::size_t>(assets));
+    std::vector<double> weight(static_cast<std::size_t>(assets));
+    for (int i = 0; i < assets; ++i) {
+        const BasketAsset& asset = option.assets[static_cast<std::size_t>(i)];
+        const double vol_sqrt_dt = asset.volatility * std::sqrt(dt);
+        for (int j = 0; j <= i; ++j) {
+            factor[static_cast<std::size_t>(i * assets + j)] *= vol_sqrt_dt;
+        }
+        drift[static_cast<std::size_t>(i)] =
+            (option.risk_free_rate - asset.dividend_yield - 0.5 * asset.volatility * asset.volatility) * dt;
+        spot[static_cast<std::size_t>(i)] = asset.initial_price;
+        weight[static_cast<std::size_t>(i)] = asset.weight;
+    }
+    const BasketModel model{assets, option.num_steps, factor.data(), drift.data(), spot.data(), weight.data(),
+                            option.strike_price, option.payoff};
+
+    const auto kernel = simd_kernels(isa).basket;
+    const auto num_blocks = static_cast<std::size_t>((total_paths + kPathsPerBlock - 1) / kPathsPerBlock);
+    std::vector<BlockSums> blocks(num_blocks);
+    parallel_for(num_blocks, num_threads, [&](std::size_t block) {
+        const std::int64_t first = static_cast<std::int64_t>(block) * kPathsPerBlock;
+        blocks[block] = kernel(model, seed, first, std::min(kPathsPerBlock, total_paths - first));
+    });
+
+    // finish_result only reads the rate and maturity.
+    OptionData discounting{};
+    discounting.risk_free_rate = option.risk_free_rate;
+    discounting.time_to_maturity = option.time_to_maturity;
+    return finish_result(discounting, pairwise_sum(blocks, 0, num_blocks));
+}
@@ -0,0 +1,40 @@
+// src/pricer/basket_engine.h
+#pragma once
+
+#include "pricer/basket_kernel.h"
+#include "pricer/option_data.h"
+#include "pricer/simd_engine.h"
+#include <cstdint>
+#include <vector>
+
+struct BasketAsset {
+    double initial_price;   // S0_i
+    double volatility;      // sigma_i
+    double dividend_yield;  // q_i
+    double weight;          // w_i, in units of the asset
+};
+
+// A European option on up to kMaxBasketAssets correlated geometric Brownian motions.
+struct BasketOption {
+    std::vector<BasketAsset> assets;
+    std::vector<double> correlation;  // K x K row-major: symmetric, unit diagonal, positive definite
+    double strike_price;
+    double risk_free_rate;
+    double time_to_maturity;
+    BasketPayoffKind payoff = BasketPayoffKind::Call;
+    int num_simulations;
+    // The payoffs only depend on S_T, which one step already samples exactly;
+    // more steps are for studying the per-step cost.
+    int num_steps = 1;
+};
+
+// Lower-triangular L with L L^T = matrix (n x n, row-major).
+// Throws std::invalid_argument if the matrix is not symmetric positive definite.
+std::vector<double> cholesky_factor(const std::vector<double>& matrix, int n);
+
+// Basket or rainbow option on `num_threads` threads (0 = all cores). The correlation
+// is factored once; the kernel correlates the normals of kBasketBatch paths at a
+// time with a blocked matrix product. Same bits for every thread count and ISA.
+// Throws std::invalid_argument for an empty or oversized basket or a bad correlation.
+McResult run_monte_carlo_basket(const BasketOption& option, std::uint64_t seed, unsigned num_threads = 0);
+McResult run_monte_carlo_basket(const BasketOption& option, std::uint64_t seed, unsigned num_threads, SimdIsa isa);
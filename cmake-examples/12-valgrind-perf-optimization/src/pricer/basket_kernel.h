@@ -0,0 +1,130 @@
+// src/pricer/basket_kernel.h
+#pragma once
+
+#include "pricer/mc_sums.h"
+#include "pricer/path_kernel.h"
+#include "pricer/vector_math.h"
+#include <cstdint>
+
+// Limits of the basket kernel: assets per basket, and paths advanced together.
+// A batch of normals (kMaxBasketAssets x kBasketBatch doubles) is 32 KB and stays in L1.
+constexpr int kMaxBasketAssets = 64;
+constexpr int kBasketBatch = 64;
+
+enum class BasketPayoffKind {
+    Call,         // max(sum_i w_i S_i - K, 0)
+    Put,          // max(K - sum_i w_i S_i, 0)
+    BestOfCall,   // max(max_i w_i S_i - K, 0)
+    WorstOfCall,  // max(min_i w_i S_i - K, 0)
+};
+
+// Everything the kernel needs, precomputed by run_monte_carlo_basket() (basket_engine.h).
+// Plain arrays rather than std::vector: see the note in vector_math.h.
+struct BasketModel {
+    int num_assets;
+    int num_steps;
+    const double* factor;     // K x K row-major, row i = sigma_i sqrt(dt) * row i of the Cholesky factor
+    const double* drift;      // (r - q_i - sigma_i^2 / 2) dt
+    const double* spot;
+    const double* weight;
+    double strike;
+    BasketPayoffKind payoff;
+};
+
+// Basket payoffs of paths [first_path, first_path + count), kBasketBatch paths at a time.
+//
+// Per step, the batch's independent normals Z (assets x paths, paths contiguous) are
+// correlated by one small matrix product X = L Z instead of a K x K loop per path:
+// each L[i][j] is broadcast once and multiplied into a tile of 4 vectors of paths,
+// whose accumulators stay in registers for the whole row. The sum over j runs in the
+// same order for every lane, so all instruction sets return the same bits.
+template <class Ops>
+BlockSums simulate_basket_block(const BasketModel& model, std::uint64_t seed,
+                                std::int64_t first_path, std::int64_t count) {
+    using D = typename Ops::Double;
+    constexpr int kTile = 4 * Ops::kWidth;
+    static_assert(kBasketBatch % kTile == 0 && kBasketBatch % kKernelGroup == 0, "batch must hold whole tiles");
+
+    const int assets = model.num_assets;
+    const auto pairs = static_cast<std::uint32_t>((assets + 1) / 2);  // Philox blocks per step
+    const D zero = Ops::set(0.0);
+
+    alignas(64) double normals[kMaxBasketAssets * kBasketBatch];
+    alignas(64) double log_price[kMaxBasketAssets * kBasketBatch];
+    double sum[kKernelGroup] = {};
+    double sum_sq[kKernelGroup] = {};
+
+    for (std::int64_t batch = first_path; batch < first_path + count; batch += kBasketBatch) {
+        for (int i = 0; i < assets * kBasketBatch; i += Ops::kWidth) {
+            Ops::store(log_price + i, zero);
+        }
+
+        for (int step = 0; step < model.num_steps; ++step) {
+            // Independent normals: asset pair a of path p comes from Philox block (step, a).
+            for (int p = 0; p < kBasketBatch; p += Ops::kWidth) {
+                const vmath::PhiloxLanes<Ops> rng(seed, static_cast<std::uint64_t>(batch + p));
+                for (int a = 0; a < assets; a += 2) {
+                    D u1, u2, z0, z1;
+                    rng.uniforms(static_cast<std::uint32_t>(step) * pairs + static_cast<std::uint32_t>(a / 2), u1, u2);
+                    vmath::box_muller<Ops>(u1, u2, z0, z1);
+                    Ops::store(normals + a * kBasketBatch + p, z0);
+                    if (a + 1 < assets) {
+                        Ops::store(normals + (a + 1) * kBasketBatch + p, z1);
+                    }
+                }
+            }
+
+            // log S_i += drift_i + sum_{j <= i} L'[i][j] Z_j, one register tile of paths at a time.
+            for (int i = 0; i < assets; ++i) {
+                const double* row = model.factor + i * assets;
+                const D drift = Ops::set(model.drift[i]);
+                for (int p = 0; p < kBasketBatch; p += kTile) {
+                    D acc0 = zero, acc1 = zero, acc2 = zero, acc3 = zero;
+                    for (int j = 0; j <= i; ++j) {
+                        const D l = Ops::set(row[j]);
+                        const double* z = normals + j * kBasketBatch + p;
+                        acc0 = Ops::add(acc0, Ops::mul(l, Ops::load(z)));
+                        acc1 = Ops::add(acc1, Ops::mul(l, Ops::load(z + Ops::kWidth)));
+                        acc2 = Ops::add(acc2, Ops::mul(l, Ops::load(z + 2 * Ops::kWidth)));
+                        acc3 = Ops::add(acc3, Ops::mul(l, Ops::load(z + 3 * Ops::kWidth)));
+                    }
+                    double* x = log_price + i * kBasketBatch + p;
+                    Ops::store(x, Ops::add(Ops::load(x), Ops::add(drift, acc0)));
+                    Ops::store(x + Ops::kWidth, Ops::add(Ops::load(x + Ops::kWidth), Ops::add(drift, acc1)));
+                    Ops::store(x + 2 * Ops::kWidth, Ops::add(Ops::load(x + 2 * Ops::kWidth), Ops::add(drift, acc2)));
+                    Ops::store(x + 3 * Ops::kWidth, Ops::add(Ops::load(x + 3 * Ops::kWidth), Ops::add(drift, acc3)));
+                }
+            }
+        }
+
+        // Payoffs at maturity, Ops::kWidth paths at a time.
+        alignas(64) double payoff[kBasketBatch];
+        const D strike = Ops::set(model.strike);
+        for (int p = 0; p < kBasketBatch; p += Ops::kWidth) {
+            D basket = zero;
+            for (int i = 0; i < assets; ++i) {
+                const D price = Ops::mul(Ops::set(model.spot[i] * model.weight[i]),
+                                         vmath::exp<Ops>(Ops::load(log_price + i * kBasketBatch + p)));
+                if (i == 0) {
+                    basket = price;
+                } else if (model.payoff == BasketPayoffKind::BestOfCall) {
+                    basket = Ops::max(basket, price);
+                } else if (model.payoff == BasketPayoffKind::WorstOfCall) {
+                    basket = Ops::min(basket, price);
+                } else {
+                    basket = Ops::add(basket, price);
+                }
+            }
+            const D intrinsic = model.payoff == BasketPayoffKind::Put ? Ops::sub(strike, basket) : Ops::sub(basket, strike);
+            Ops::store(payoff + p, Ops::max(intrinsic, zero));
+        }
+
+        const std::int64_t valid = first_path + count - batch;  // the last batch may be partial
+        for (int p = 0; p < kBasketBatch && p < valid; ++p) {
+            sum[p % kKernelGroup] += payoff[p];
+            sum_sq[p % kKernelGroup] += payoff[p] * payoff[p];
+        }
+    }
+
+    return BlockSums{kernel_detail::combine_group<Ops>(sum), kernel_detail::combine_group<Ops>(sum_sq), count};
+}
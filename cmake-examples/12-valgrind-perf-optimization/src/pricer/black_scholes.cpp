@@ -0,0 +1,105 @@
+// src/pricer/black_scholes.cpp
+#include "pricer/black_scholes.h"
+#include <cmath>
+#include <stdexcept>
+
+double normal_cdf(double x) {
+    return 0.5 * std::erfc(-x / std::sqrt(2.0));
+}
+
+double inverse_normal_cdf(double p) {
+    constexpr double a[] = {-3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+                            1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00};
+    constexpr double b[] = {-5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+                            6.680131188771972e+01, -1.328068155288572e+01};
+    constexpr double c[] = {-7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                            -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00};
+    constexpr double d[] = {7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+                            3.754408661907416e+00};
+    constexpr double kLow = 0.02425;
+
+    if (p < kLow || p > 1.0 - kLow) {
+        // Tails, by symmetry around p = 0.5.
+        const double q = std::sqrt(-2.0 * std::log(p < kLow ? p : 1.0 - p));
+        const double x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+                         ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+        return p < kLow ? x : -x;
+    }
+    const double q = p - 0.5;
+    const double r = q * q;
+    return (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+           (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+}
+
+double black_scholes_call(const OptionData& data) {
+    const double s = data.initial_price;
+    const double k = data.strike_price;
+    const double r = data.risk_free_rate;
+    const double sigma = data.volatility;
+    const double t = data.time_to_maturity;
+
+    const double sigma_sqrt_t = sigma * std::sqrt(t);
+    const double d1 = (std::log(s / k) + (r + 0.5 * sigma * sigma) * t) / sigma_sqrt_t;
+    const double d2 = d1 - sigma_sqrt_t;
+    return s * normal_cdf(d1) - k * std::exp(-r * t) * normal_cdf(d2);
+}
+
+double black_scholes_put(const OptionData& data) {
+    // Put-call parity: C - P = S - K e^{-rT}
+    return black_scholes_call(data) - data.initial_price +
+           data.strike_price * std::exp(-data.risk_free_rate * data.time_to_maturity);
+}
+
+double black_scholes_price(const OptionData& data) {
+    switch (data.style) {
+        case OptionStyle::EuropeanCall: return black_scholes_call(data);
+        case OptionStyle::EuropeanPut:  return black_scholes_put(data);
+        default: break;
+    }
+    throw std::invalid_argument("black_scholes_price: option style has no closed form");
+}
+
+BlackScholesGreeks black_scholes_greeks(const OptionData& data) {
+    const double s = data.initial_price;
+    const double k = data.strike_price;
+    const double r = data.risk_free_rate;
+    const double sigma = data.volatility;
+    const double t = data.time_to_maturity;
+
+    const double sigma_sqrt_t = sigma * std::sqrt(t);
+    const double d1 = (std::log(s / k) + (r + 0.5 * sigma * sigma) * t) / sigma_sqrt_t;
+    const double d2 = d1 - sigma_sqrt_t;
+    const double density = 0.3989422804014327 * std::exp(-0.5 * d1 * d1);  // 1/sqrt(2 pi) e^{-d1^2/2}
+    const double discounted_strike = k * std::exp(-r * t);
+
+    BlackScholesGreeks greeks;
+    greeks.price = black_scholes_price(data);
+    greeks.gamma = density / (s * sigma_sqrt_t);
+    greeks.vega = s * density * std::sqrt(t);
+    if (data.style == OptionStyle::EuropeanPut) {
+        greeks.delta = normal_cdf(d1) - 1.0;
+        greeks.rho = -t * discounted_strike * normal_cdf(-d2);
+    } else {
+        greeks.delta = normal_cdf(d1);
+        greeks.rho = t * discounted_strike * normal_cdf(d2);
+    }
+    return greeks;
+}
+
+double geometric_asian_price(const OptionData& data, bool call) {
+    // log G = log S0 + (1/n) sum_i log(S_ti / S0) with t_i = i dt:
+    // mean log S0 + (r - sigma^2/2) dt (n+1)/2, variance sigma^2 dt (n+1)(2n+1)/(6n)
+    const double n = data.num_steps;
+    const double dt = data.time_to_maturity / n;
+    const double mean = std::log(data.initial_price) +
+                        (data.risk_free_rate - 0.5 * data.volatility * data.volatility) * dt * (n + 1.0) / 2.0;
+    const double stddev = data.volatility * std::sqrt(dt * (n + 1.0) * (2.0 * n + 1.0) / (6.0 * n));
+    const double forward = std::exp(mean + 0.5 * stddev * stddev);  // E[G]
+    const double d2 = (mean - std::log(data.strike_price)) / stddev;
+    const double d1 = d2 + stddev;
+    const double discount = std::exp(-data.risk_free_rate * data.time_to_maturity);
+    if (call) {
+        return discount * (forward * normal_cdf(d1) - data.strike_price * normal_cdf(d2));
+    }
+    return discount * (data.strike_price * normal_cdf(-d2) - forward * normal_cdf(-d1));
+}
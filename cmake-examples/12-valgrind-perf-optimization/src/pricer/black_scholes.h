@@ -0,0 +1,37 @@
+// src/pricer/black_scholes.h
+#pragma once
+
+#include "pricer/option_data.h"
+
+// Closed-form Black-Scholes price of the European call described by `data`
+// (num_simulations and num_steps are ignored). The reference for the Monte Carlo engines.
+double black_scholes_call(const OptionData& data);
+double black_scholes_put(const OptionData& data);
+
+// Call or put according to data.style; must be a European style.
+double black_scholes_price(const OptionData& data);
+
+// Closed-form sensitivities of black_scholes_price(), the reference for the Monte
+// Carlo Greeks. vega and rho per unit (1.0 = 100%) of volatility and rate.
+struct BlackScholesGreeks {
+    double price;
+    double delta;
+    double gamma;
+    double vega;
+    double rho;
+};
+
+BlackScholesGreeks black_scholes_greeks(const OptionData& data);
+
+// Geometric-average Asian call or put on the num_steps dates dt, 2 dt, ..., T.
+// log G is normal, so this is Black-Scholes with the mean and variance of log G;
+// the reference for the arithmetic Asian, which has no closed form.
+double geometric_asian_price(const OptionData& data, bool call);
+
+// Standard normal cumulative distribution function.
+double normal_cdf(double x);
+
+// Its inverse for p in (0, 1): Acklam's rational approximation, relative error
+// below 1.2e-9, far below the Monte Carlo error. Turns quasi-random uniforms into
+// normals one coordinate at a time, which Box-Muller (pairs) cannot do.
+double inverse_normal_cdf(double p);
@@ -0,0 +1,47 @@
+// src/pricer/black_scholes_kernel.h
+#pragma once
+
+#include "pricer/vector_math.h"
+#include <cstddef>
+
+// Structure-of-arrays input of the vectorized Black-Scholes kernel.
+// call[i] is 1.0 for a call and 0.0 for a put.
+struct BlackScholesBatch {
+    const double* spot;
+    const double* strike;
+    const double* rate;
+    const double* volatility;
+    const double* maturity;
+    const double* call;
+};
+
+// Prices count options, Ops::kWidth per iteration. count must be a multiple
+// of 8 (pad the arrays): a scalar tail loop would pull shared code into ISA files.
+template <class Ops>
+void black_scholes_batch(const BlackScholesBatch& batch, std::size_t count, double* prices) {
+    using D = typename Ops::Double;
+    const D half = Ops::set(0.5);
+    const D zero = Ops::set(0.0);
+    for (std::size_t i = 0; i < count; i += Ops::kWidth) {
+        const D s = Ops::load(batch.spot + i);
+        const D k = Ops::load(batch.strike + i);
+        const D r = Ops::load(batch.rate + i);
+        const D sigma = Ops::load(batch.volatility + i);
+        const D t = Ops::load(batch.maturity + i);
+        const auto is_call = Ops::greater(Ops::load(batch.call + i), half);
+
+        const D sigma_sqrt_t = Ops::mul(sigma, Ops::sqrt(t));
+        const D d1 = Ops::div(Ops::add(vmath::log<Ops>(Ops::div(s, k)),
+                                       Ops::mul(Ops::add(r, Ops::mul(half, Ops::mul(sigma, sigma))), t)),
+                              sigma_sqrt_t);
+        const D d2 = Ops::sub(d1, sigma_sqrt_t);
+        const D discounted_strike = Ops::mul(k, vmath::exp<Ops>(Ops::sub(zero, Ops::mul(r, t))));
+
+        // call: S N(d1) - K e^{-rT} N(d2); put: K e^{-rT} N(-d2) - S N(-d1)
+        const D sign = Ops::select(is_call, Ops::set(1.0), Ops::set(-1.0));
+        const D n1 = vmath::normal_cdf<Ops>(Ops::mul(sign, d1));
+        const D n2 = vmath::normal_cdf<Ops>(Ops::mul(sign, d2));
+        const D price = Ops::mul(sign, Ops::sub(Ops::mul(s, n1), Ops::mul(discounted_strike, n2)));
+        Ops::store(prices + i, price);
+    }
+}
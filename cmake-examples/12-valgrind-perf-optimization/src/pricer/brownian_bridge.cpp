@@ -0,0 +1,63 @@
+// src/pricer/brownian_bridge.cpp
+#include "pricer/brownian_bridge.h"
+#include <cmath>
+#include <stdexcept>
+
+BrownianBridge::BrownianBridge(int num_steps) {
+    if (num_steps < 1) {
+        throw std::invalid_argument("BrownianBridge: at least one step is required");
+    }
+    const std::size_t n = static_cast<std::size_t>(num_steps);
+    m_bridge_index.resize(n);
+    m_left_index.resize(n);
+    m_right_index.resize(n);
+    m_left_weight.resize(n);
+    m_right_weight.resize(n);
+    m_std_dev.resize(n);
+
+    // Times in units of dt: t_i = i + 1 for point i. Fills the largest gap's midpoint
+    // first, sweeping left to right (the construction of Jäckel, "Monte Carlo Methods in Finance").
+    std::vector<int> filled(n, 0);
+    filled[n - 1] = 1;
+    m_bridge_index[0] = static_cast<int>(n - 1);
+    m_std_dev[0] = std::sqrt(static_cast<double>(n));
+
+    std::size_t j = 0;
+    for (std::size_t i = 1; i < n; ++i) {
+        while (filled[j]) {
+            ++j;                       // first unfilled point
+        }
+        std::size_t k = j;
+        while (!filled[k]) {
+            ++k;                       // next filled point to its right
+        }
+        const std::size_t l = j + ((k - 1 - j) >> 1);
+        filled[l] = 1;
+
+        const double t_left = static_cast<double>(j);  // time of point j - 1, or 0
+        const double t_mid = static_cast<double>(l + 1);
+        const double t_right = static_cast<double>(k + 1);
+        m_bridge_index[i] = static_cast<int>(l);
+        m_left_index[i] = static_cast<int>(j);
+        m_right_index[i] = static_cast<int>(k);
+        m_left_weight[i] = (t_right - t_mid) / (t_right - t_left);
+        m_right_weight[i] = (t_mid - t_left) / (t_right - t_left);
+        m_std_dev[i] = std::sqrt((t_mid - t_left) * (t_right - t_mid) / (t_right - t_left));
+
+        j = k + 1;
+        if (j >= n) {
+            j = 0;
+        }
+    }
+}
+
+void BrownianBridge::build(const double* normals, double* path) const {
+    const std::size_t n = m_bridge_index.size();
+    path[n - 1] = m_std_dev[0] * normals[0];
+    for (std::size_t i = 1; i < n; ++i) {
+        const int left = m_left_index[i];
+        const double left_value = left > 0 ? path[left - 1] : 0.0;
+        path[m_bridge_index[i]] = m_left_weight[i] * left_value + m_right_weight[i] * path[m_right_index[i]] +
+                                  m_std_dev[i] * normals[i];
+    }
+}
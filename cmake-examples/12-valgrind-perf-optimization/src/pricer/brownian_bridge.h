@@ -0,0 +1,27 @@
+// src/pricer/brownian_bridge.h
+#pragma once
+
+#include <vector>
+
+// Brownian bridge construction of W(t_1), ..., W(t_n) on the equally spaced dates
+// t_i = i dt: the first normal sets W(T), the second the midpoint, then the
+// quarter points, and so on. The first few (best distributed) quasi-random
+// coordinates then decide the overall shape of the path, which is what the
+// payoff mostly depends on; that concentrates the effective dimension of the problem.
+class BrownianBridge {
+public:
+    explicit BrownianBridge(int num_steps);
+
+    int num_steps() const { return static_cast<int>(m_bridge_index.size()); }
+
+    // W(t_1) .. W(t_n) in units of sqrt(dt) from n independent standard normals.
+    void build(const double* normals, double* path) const;
+
+private:
+    std::vector<int> m_bridge_index;   // point set by normal i
+    std::vector<int> m_left_index;     // left neighbour + 1 (0 = W(0) = 0)
+    std::vector<int> m_right_index;
+    std::vector<double> m_left_weight;
+    std::vector<double> m_right_weight;
+    std::vector<double> m_std_dev;
+};
@@ -0,0 +1,136 @@
+// src/pricer/chain_pricer.cpp
+#include "pricer/chain_pricer.h"
+#include "pricer/parallel_engine.h"
+#include "pricer/parallel_for.h"
+#include "pricer/simd_engine.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+// Options that can share simulated paths.
+using PathKey = std::tuple<double, double, double, double, int, int>;
+
+PathKey path_key(const OptionData& data) {
+    return {data.initial_price, data.risk_free_rate, data.volatility, data.time_to_maturity,
+            data.num_steps, data.num_simulations};
+}
+
+void price_european(std::span<const OptionData> options, const std::vector<std::size_t>& indices,
+                    std::span<McResult> results, const SimdKernels& kernels, unsigned num_threads) {
+    // Gather into padded structure-of-arrays form; padding lanes price a harmless dummy.
+    const std::size_t padded = (indices.size() + 7) / 8 * 8;
+    std::vector<double> spot(padded, 1.0), strike(padded, 1.0), rate(padded, 0.0), volatility(padded, 0.2),
+        maturity(padded, 1.0), call(padded, 1.0), prices(padded);
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+        const OptionData& option = options[indices[i]];
+        spot[i] = option.initial_price;
+        strike[i] = option.strike_price;
+        rate[i] = option.risk_free_rate;
+        volatility[i] = option.volatility;
+        maturity[i] = option.time_to_maturity;
+        call[i] = option.style == OptionStyle::EuropeanCall ? 1.0 : 0.0;
+    }
+
+    const BlackScholesBatch batch{spot.data(), strike.data(), rate.data(), volatility.data(), maturity.data(), call.data()};
+    constexpr std::size_t kChunk = 4096;  // multiple of 8
+    parallel_for((padded + kChunk - 1) / kChunk, num_threads, [&](std::size_t chunk) {
+        const std::size_t begin = chunk * kChunk;
+        const BlackScholesBatch part{batch.spot + begin, batch.strike + begin, batch.rate + begin,
+                                     batch.volatility + begin, batch.maturity + begin, batch.call + begin};
+        kernels.black_scholes(part, std::min(kChunk, padded - begin), prices.data() + begin);
+    });
+
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+        results[indices[i]] = McResult{prices[i], 0.0, 0};
+    }
+}
+
+// One path set, all strikes of the group.
+void price_asian_group(std::span<const OptionData> options, const std::vector<std::size_t>& indices,
+                       std::span<McResult> results, const SimdKernels& kernels, const ChainConfig& config) {
+    const OptionData& data = options[indices.front()];
+    const std::int64_t total_paths = data.num_simulations;
+    if (total_paths <= 0) {
+        // No paths, no estimate: empty results, as run_monte_carlo_basket() returns.
+        for (std::size_t index : indices) {
+            results[index] = McResult{};
+        }
+        return;
+    }
+    std::vector<double> averages(static_cast<std::size_t>(total_paths));
+
+    const auto num_blocks = static_cast<std::size_t>((total_paths + kPathsPerBlock - 1) / kPathsPerBlock);
+    parallel_for(num_blocks, config.num_threads, [&](std::size_t block) {
+        const std::int64_t first = static_cast<std::int64_t>(block) * kPathsPerBlock;
+        kernels.arithmetic_averages(data, config.seed, first, std::min(kPathsPerBlock, total_paths - first),
+                                    averages.data() + first);
+    });
+
+    // Sorted averages with suffix sums of (A - c) and (A - c)^2, centred on the mean c
+    // to keep the second moment accurate. For strike K, the paths with A > K pay A - K.
+    std::sort(averages.begin(), averages.end());
+    double centre = 0.0;
+    for (double average : averages) {
+        centre += average;
+    }
+    centre /= static_cast<double>(total_paths);
+
+    std::vector<double> suffix(averages.size() + 1, 0.0);
+    std::vector<double> suffix_sq(averages.size() + 1, 0.0);
+    for (std::size_t i = averages.size(); i-- > 0;) {
+        const double d = averages[i] - centre;
+        suffix[i] = suffix[i + 1] + d;
+        suffix_sq[i] = suffix_sq[i + 1] + d * d;
+    }
+
+    const double discount = std::exp(-data.risk_free_rate * data.time_to_maturity);
+    const double n = static_cast<double>(total_paths);
+    for (std::size_t index : indices) {
+        const double strike = options[index].strike_price;
+        const auto first = static_cast<std::size_t>(
+            std::upper_bound(averages.begin(), averages.end(), strike) - averages.begin());
+        const double in_the_money = static_cast<double>(averages.size() - first);
+        // payoff = (A - c) - (K - c) for A > K
+        const double shift = strike - centre;
+        const double sum = suffix[first] - shift * in_the_money;
+        const double sum_sq = suffix_sq[first] - 2.0 * shift * suffix[first] + shift * shift * in_the_money;
+        const double mean = sum / n;
+        const double variance = n > 1.0 ? std::max(0.0, (sum_sq - n * mean * mean) / (n - 1.0)) : 0.0;
+        results[index] = McResult{discount * mean, discount * std::sqrt(variance / n), total_paths};
+    }
+}
+
+} // namespace
+
+void price_option_chain(std::span<const OptionData> options, std::span<McResult> results, const ChainConfig& config) {
+    if (options.size() != results.size()) {
+        throw std::invalid_argument("price_option_chain: options and results differ in size");
+    }
+    const SimdKernels& kernels = simd_kernels(best_simd_isa());
+
+    std::vector<std::size_t> european;
+    std::map<PathKey, std::vector<std::size_t>> simulated;
+    for (std::size_t i = 0; i < options.size(); ++i) {
+        switch (options[i].style) {
+            case OptionStyle::EuropeanCall:
+            case OptionStyle::EuropeanPut:
+                european.push_back(i);
+                break;
+            case OptionStyle::ArithmeticAsianCall:
+                simulated[path_key(options[i])].push_back(i);
+                break;
+        }
+    }
+
+    if (!european.empty()) {
+        price_european(options, european, results, kernels, config.num_threads);
+    }
+    for (const auto& [key, indices] : simulated) {
+        price_asian_group(options, indices, results, kernels, config);
+    }
+}
@@ -0,0 +1,24 @@
+// src/pricer/chain_pricer.h
+#pragma once
+
+#include "pricer/option_data.h"
+#include <cstdint>
+#include <span>
+
+struct ChainConfig {
+    std::uint64_t seed = 42;
+    unsigned num_threads = 0;   // 0 = all cores
+};
+
+// Prices a whole option chain, results[i] for options[i].
+//
+// European calls and puts go to the vectorized closed-form Black-Scholes kernel
+// (std_error 0, paths 0). Options that need simulation are grouped by underlying,
+// rate, volatility, maturity, steps and path count; each group simulates its paths
+// once and prices every strike from them: path payoffs are sorted once, after which
+// each strike costs a binary search over running sums instead of a pass over all paths.
+//
+// Options with num_simulations <= 0 that need simulation get an empty McResult{}.
+// Throws std::invalid_argument if the spans differ in size.
+void price_option_chain(std::span<const OptionData> options, std::span<McResult> results,
+                        const ChainConfig& config = {});
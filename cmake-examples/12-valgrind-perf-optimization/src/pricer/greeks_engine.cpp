@@ -0,0 +1,53 @@
+// src/pricer/greeks_engine.cpp
+#include "pricer/greeks_engine.h"
+#include "pricer/parallel_engine.h"
+#include "pricer/parallel_for.h"
+#include "pricer/simd_engine.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+McEstimate estimate(const GreekSums& sums, int estimator, double discount) {
+    const double n = static_cast<double>(sums.paths);
+    const double mean = sums.sum[estimator] / n;
+    const double variance = sums.paths > 1
+        ? std::max(0.0, (sums.sum_sq[estimator] - n * mean * mean) / (n - 1.0)) : 0.0;
+    return McEstimate{discount * mean, discount * std::sqrt(variance / n)};
+}
+
+} // namespace
+
+McGreeks run_monte_carlo_greeks(const OptionData& data, std::uint64_t seed, unsigned num_threads) {
+    if (data.style == OptionStyle::ArithmeticAsianCall) {
+        throw std::invalid_argument("run_monte_carlo_greeks: European calls and puts only");
+    }
+    const std::int64_t total_paths = data.num_simulations;
+    if (total_paths <= 0) {
+        return McGreeks{};
+    }
+    const auto kernel = simd_kernels(best_simd_isa()).greeks;
+    const auto num_blocks = static_cast<std::size_t>((total_paths + kPathsPerBlock - 1) / kPathsPerBlock);
+    std::vector<GreekSums> blocks(num_blocks);
+
+    parallel_for(num_blocks, num_threads, [&](std::size_t block) {
+        const std::int64_t first = static_cast<std::int64_t>(block) * kPathsPerBlock;
+        blocks[block] = kernel(data, seed, first, std::min(kPathsPerBlock, total_paths - first));
+    });
+    const GreekSums total = pairwise_sum(blocks, 0, num_blocks);
+
+    const double discount = std::exp(-data.risk_free_rate * data.time_to_maturity);
+    McGreeks greeks;
+    greeks.price = estimate(total, kGreekPrice, discount);
+    greeks.delta = estimate(total, kDeltaPathwise, discount);
+    greeks.gamma = estimate(total, kGammaMixed, discount);
+    greeks.vega = estimate(total, kVegaPathwise, discount);
+    greeks.rho = estimate(total, kRhoPathwise, discount);
+    greeks.delta_lr = estimate(total, kDeltaLikelihoodRatio, discount);
+    greeks.gamma_lr = estimate(total, kGammaLikelihoodRatio, discount);
+    greeks.vega_lr = estimate(total, kVegaLikelihoodRatio, discount);
+    greeks.paths = total.paths;
+    return greeks;
+}
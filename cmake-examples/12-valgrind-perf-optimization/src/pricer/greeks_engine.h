@@ -0,0 +1,33 @@
+// src/pricer/greeks_engine.h
+#pragma once
+
+#include "pricer/option_data.h"
+#include <cstdint>
+
+// A Monte Carlo estimate and its standard error.
+struct McEstimate {
+    double value = 0.0;
+    double std_error = 0.0;
+};
+
+// Price and Greeks of a European option from one simulation.
+// delta, gamma, vega and rho are the lowest-variance estimators (pathwise delta,
+// vega and rho, mixed gamma); the *_lr fields are the likelihood-ratio versions,
+// which also work for discontinuous payoffs. vega and rho per unit of volatility/rate.
+struct McGreeks {
+    McEstimate price;
+    McEstimate delta;
+    McEstimate gamma;
+    McEstimate vega;
+    McEstimate rho;
+    McEstimate delta_lr;
+    McEstimate gamma_lr;
+    McEstimate vega_lr;
+    std::int64_t paths = 0;
+};
+
+// European call or put (data.style) and its Greeks on the SIMD kernel, in one pass
+// over the same paths as run_monte_carlo_simd() (simd_engine.h), so for a call the
+// price agrees with it up to rounding. Bumping inputs and repricing needs 5-7 passes and
+// matched seeds for the same set of Greeks.
+McGreeks run_monte_carlo_greeks(const OptionData& data, std::uint64_t seed, unsigned num_threads = 0);
@@ -0,0 +1,200 @@
+// src/pricer/lsm_engine.cpp
+#include "pricer/lsm_engine.h"
+#include "pricer/parallel_engine.h"
+#include "pricer/parallel_for.h"
+#include "pricer/simd_engine.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// The kernels of one storage type.
+template <class T>
+struct LsmKernels;
+
+template <>
+struct LsmKernels<double> {
+    static auto path_rows(const SimdKernels& k) { return k.path_rows; }
+    static auto regression(const SimdKernels& k) { return k.lsm_regression; }
+    static auto exercise(const SimdKernels& k) { return k.lsm_exercise; }
+};
+
+template <>
+struct LsmKernels<float> {
+    static auto path_rows(const SimdKernels& k) { return k.path_rows_float; }
+    static auto regression(const SimdKernels& k) { return k.lsm_regression_float; }
+    static auto exercise(const SimdKernels& k) { return k.lsm_exercise_float; }
+};
+
+// Least squares through the normal equations A c = b, A[i][j] = moment[i + j], by
+// Gaussian elimination with partial pivoting. False if A is (numerically) singular.
+bool solve_normal_equations(const RegressionSums& sums, int basis, double* coefficients) {
+    double a[kMaxLsmBasis][kMaxLsmBasis + 1];
+    for (int i = 0; i < basis; ++i) {
+        for (int j = 0; j < basis; ++j) {
+            a[i][j] = sums.moment[i + j];
+        }
+        a[i][basis] = sums.target[i];
+    }
+    for (int col = 0; col < basis; ++col) {
+        int pivot = col;
+        for (int row = col + 1; row < basis; ++row) {
+            if (std::abs(a[row][col]) > std::abs(a[pivot][col])) {
+                pivot = row;
+            }
+        }
+        if (std::abs(a[pivot][col]) < 1e-12 * std::abs(a[0][0])) {
+            return false;
+        }
+        std::swap(a[col], a[pivot]);
+        for (int row = col + 1; row < basis; ++row) {
+            const double factor = a[row][col] / a[col][col];
+            for (int j = col; j <= basis; ++j) {
+                a[row][j] -= factor * a[col][j];
+            }
+        }
+    }
+    for (int row = basis - 1; row >= 0; --row) {
+        double value = a[row][basis];
+        for (int j = row + 1; j < basis; ++j) {
+            value -= a[row][j] * coefficients[j];
+        }
+        coefficients[row] = value / a[row][row];
+    }
+    return true;
+}
+
+template <class T>
+LsmResult run_lsm(const OptionData& data, const LsmConfig& config, int dates) {
+    using Clock = std::chrono::steady_clock;
+    using Kernels = LsmKernels<T>;
+    const SimdKernels& kernels = simd_kernels(best_simd_isa());
+    const std::int64_t total_paths = data.num_simulations;
+    const std::int64_t stride = (total_paths + kKernelGroup - 1) / kKernelGroup * kKernelGroup;
+    const int steps_per_date = data.num_steps / dates;
+    const auto num_blocks = static_cast<std::size_t>((total_paths + kPathsPerBlock - 1) / kPathsPerBlock);
+    auto block_first = [](std::size_t block) { return static_cast<std::int64_t>(block) * kPathsPerBlock; };
+    auto block_count = [&](std::size_t block) { return std::min(kPathsPerBlock, total_paths - block_first(block)); };
+
+    LsmResult result;
+    result.paths = total_paths;
+    result.exercise_dates = dates;
+
+    // One allocation for all paths, row r = exercise date r + 1.
+    auto start = Clock::now();
+    std::vector<T> matrix(static_cast<std::size_t>(stride) * static_cast<std::size_t>(dates));
+    result.path_bytes = matrix.size() * sizeof(T);
+    parallel_for(num_blocks, config.num_threads, [&](std::size_t block) {
+        Kernels::path_rows(kernels)(data, config.seed, block_first(block), block_count(block), steps_per_date,
+                                    matrix.data(), stride);
+    });
+    result.simulation_seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    start = Clock::now();
+    const double strike = data.strike_price;
+    const double sign = data.style == OptionStyle::EuropeanPut ? -1.0 : 1.0;
+    const double discount = std::exp(-data.risk_free_rate * data.time_to_maturity / dates);
+    const int basis = config.basis_functions;
+    auto row = [&](int date) { return matrix.data() + static_cast<std::ptrdiff_t>(date) * stride; };
+
+    // At maturity: exercise whenever in the money (continuation -1).
+    std::vector<double> cashflow(static_cast<std::size_t>(stride), 0.0);
+    const double at_maturity[kMaxLsmBasis] = {-1.0};
+    parallel_for(num_blocks, config.num_threads, [&](std::size_t block) {
+        const std::int64_t first = block_first(block);
+        Kernels::exercise(kernels)(row(dates - 1) + first, cashflow.data() + first, block_count(block),
+                                   strike, sign, at_maturity, 1);
+    });
+
+    std::vector<RegressionSums> sums(num_blocks);
+    for (int date = dates - 2; date >= 0; --date) {
+        parallel_for(num_blocks, config.num_threads, [&](std::size_t block) {
+            const std::int64_t first = block_first(block);
+            sums[block] = Kernels::regression(kernels)(row(date) + first, cashflow.data() + first, block_count(block),
+                                                       strike, sign, discount, basis);
+        });
+        const RegressionSums total = pairwise_sum(sums, 0, num_blocks);
+        double coefficients[kMaxLsmBasis] = {};
+        if (total.paths < 2 * basis || !solve_normal_equations(total, basis, coefficients)) {
+            continue;  // too few paths in the money to regress: no exercise at this date
+        }
+        parallel_for(num_blocks, config.num_threads, [&](std::size_t block) {
+            const std::int64_t first = block_first(block);
+            Kernels::exercise(kernels)(row(date) + first, cashflow.data() + first, block_count(block),
+                                       strike, sign, coefficients, basis);
+        });
+    }
+
+    // Back to today; exercising immediately is the alternative.
+    std::vector<BlockSums> blocks(num_blocks);
+    parallel_for(num_blocks, config.num_threads, [&](std::size_t block) {
+        BlockSums block_sums{0.0, 0.0, block_count(block)};
+        for (std::int64_t p = block_first(block); p < block_first(block) + block_count(block); ++p) {
+            const double value = discount * cashflow[static_cast<std::size_t>(p)];
+            block_sums.payoff += value;
+            block_sums.payoff_sq += value * value;
+        }
+        blocks[block] = block_sums;
+    });
+    const BlockSums total = pairwise_sum(blocks, 0, num_blocks);
+    const double n = static_cast<double>(total.paths);
+    const double mean = total.payoff / n;
+    const double variance = total.paths > 1 ? std::max(0.0, (total.payoff_sq - n * mean * mean) / (n - 1.0)) : 0.0;
+    const double immediate = std::max(sign * (data.initial_price - strike), 0.0);
+    result.price = std::max(mean, immediate);
+    result.std_error = mean >= immediate ? std::sqrt(variance / n) : 0.0;
+    result.regression_seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return result;
+}
+
+} // namespace
+
+LsmResult run_monte_carlo_lsm(const OptionData& data, const LsmConfig& config) {
+    if (data.style == OptionStyle::ArithmeticAsianCall) {
+        throw std::invalid_argument("run_monte_carlo_lsm: calls and puts only");
+    }
+    const int dates = config.exercise_dates == 0 ? data.num_steps : config.exercise_dates;
+    if (dates <= 0 || data.num_steps % dates != 0) {
+        throw std::invalid_argument("run_monte_carlo_lsm: exercise_dates must divide num_steps");
+    }
+    if (config.basis_functions < 1 || config.basis_functions > kMaxLsmBasis) {
+        throw std::invalid_argument("run_monte_carlo_lsm: 1 to kMaxLsmBasis basis functions");
+    }
+    if (data.num_simulations <= 0) {
+        return LsmResult{};
+    }
+    return config.single_precision ? run_lsm<float>(data, config, dates) : run_lsm<double>(data, config, dates);
+}
+
+double binomial_tree_price(const OptionData& data, int tree_steps, int exercise_every) {
+    const double dt = data.time_to_maturity / tree_steps;
+    const double up = std::exp(data.volatility * std::sqrt(dt));
+    const double down = 1.0 / up;
+    const double growth = std::exp(data.risk_free_rate * dt);
+    const double p_up = (growth - down) / (up - down);
+    const double discount = 1.0 / growth;
+    const double sign = data.style == OptionStyle::EuropeanPut ? -1.0 : 1.0;
+
+    // values[j]: node with j up moves.
+    std::vector<double> values(static_cast<std::size_t>(tree_steps) + 1);
+    for (int j = 0; j <= tree_steps; ++j) {
+        const double spot = data.initial_price * std::pow(up, 2 * j - tree_steps);
+        values[static_cast<std::size_t>(j)] = std::max(sign * (spot - data.strike_price), 0.0);
+    }
+    for (int step = tree_steps - 1; step >= 0; --step) {
+        const bool exercisable = step % exercise_every == 0;
+        for (int j = 0; j <= step; ++j) {
+            const auto i = static_cast<std::size_t>(j);
+            double value = discount * (p_up * values[i + 1] + (1.0 - p_up) * values[i]);
+            if (exercisable) {
+                const double spot = data.initial_price * std::pow(up, 2 * j - step);
+                value = std::max(value, sign * (spot - data.strike_price));
+            }
+            values[i] = value;
+        }
+    }
+    return values[0];
+}
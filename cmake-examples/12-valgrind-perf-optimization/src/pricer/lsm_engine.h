@@ -0,0 +1,42 @@
+// src/pricer/lsm_engine.h
+#pragma once
+
+#include "pricer/option_data.h"
+#include <cstddef>
+#include <cstdint>
+
+// Settings of run_monte_carlo_lsm().
+struct LsmConfig {
+    int exercise_dates = 0;          // equally spaced, must divide num_steps; 0 = every step
+    int basis_functions = 4;         // 1, x, x^2, x^3 with x = S / K (at most kMaxLsmBasis)
+    bool single_precision = false;   // store paths as float: half the memory
+    std::uint64_t seed = 42;
+    unsigned num_threads = 0;        // 0 = all cores
+};
+
+struct LsmResult {
+    double price = 0.0;
+    double std_error = 0.0;
+    std::int64_t paths = 0;
+    int exercise_dates = 0;
+    std::size_t path_bytes = 0;      // size of the path matrix
+    double simulation_seconds = 0.0; // filling the path matrix
+    double regression_seconds = 0.0; // backward induction
+};
+
+// Bermudan call or put (data.style) by Longstaff-Schwartz; with an exercise date per
+// step it approximates the American option.
+//
+// Paths are simulated in parallel into one pre-allocated, time-major matrix holding S
+// at the exercise dates only (paths x exercise_dates values, no per-path allocation).
+// Backward from maturity, each date regresses the discounted cash flows of the
+// in-the-money paths on polynomials in S / K (normal equations accumulated by a vector
+// kernel over the date's row, then solved), and exercises where the payoff beats the
+// regressed continuation value. std_error is that of the final cash flows; the
+// estimate is slightly low-biased, as the exercise rule is suboptimal.
+// Throws std::invalid_argument for invalid settings.
+LsmResult run_monte_carlo_lsm(const OptionData& data, const LsmConfig& config = {});
+
+// Cox-Ross-Rubinstein binomial tree with tree_steps steps that allows exercise every
+// `exercise_every` steps (1 = American). The reference for run_monte_carlo_lsm().
+double binomial_tree_price(const OptionData& data, int tree_steps, int exercise_every = 1);
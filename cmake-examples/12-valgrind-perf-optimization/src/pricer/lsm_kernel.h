@@ -0,0 +1,190 @@
+// src/pricer/lsm_kernel.h
+#pragma once
+
+#include "pricer/option_data.h"
+#include "pricer/path_kernel.h"
+#include "pricer/vector_math.h"
+#include <cstdint>
+
+// Longstaff-Schwartz kernels (lsm_engine.h). Path matrices are time-major: row r holds
+// S at exercise date r + 1 for all paths, `stride` (a multiple of 8) values apart,
+// so every per-date pass streams one contiguous row. T is double or float.
+
+// Regression on 1, x, ..., x^(basis - 1) with x = S / K.
+constexpr int kMaxLsmBasis = 5;
+
+// Normal equations of one block of paths: moment[k] = sum x^k and
+// target[k] = sum y x^k over the in-the-money paths, y the discounted cash flow.
+struct RegressionSums {
+    double moment[2 * kMaxLsmBasis - 1];
+    double target[kMaxLsmBasis];
+    std::int64_t paths;  // in the money
+};
+
+inline RegressionSums operator+(const RegressionSums& a, const RegressionSums& b) {
+    RegressionSums result{};
+    for (int k = 0; k < 2 * kMaxLsmBasis - 1; ++k) {
+        result.moment[k] = a.moment[k] + b.moment[k];
+    }
+    for (int k = 0; k < kMaxLsmBasis; ++k) {
+        result.target[k] = a.target[k] + b.target[k];
+    }
+    result.paths = a.paths + b.paths;
+    return result;
+}
+
+namespace kernel_detail {
+
+constexpr double kLaneIndex[kKernelGroup] = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0};
+
+template <class Ops>
+typename Ops::Double load_row(const double* values) {
+    return Ops::load(values);
+}
+
+template <class Ops>
+typename Ops::Double load_row(const float* values) {
+    alignas(64) double lanes[Ops::kWidth];
+    for (int lane = 0; lane < Ops::kWidth; ++lane) {
+        lanes[lane] = values[lane];
+    }
+    return Ops::load(lanes);
+}
+
+} // namespace kernel_detail
+
+// Simulates paths [first_path, first_path + count) and stores S every steps_per_row
+// steps into matrix[row * stride + path]. Writes whole vectors: count may be partial
+// only at the end of the padded matrix.
+template <class Ops, class T>
+void simulate_path_rows(const OptionData& data, std::uint64_t seed, std::int64_t first_path, std::int64_t count,
+                        int steps_per_row, T* matrix, std::int64_t stride) {
+    using D = typename Ops::Double;
+    const double dt = data.time_to_maturity / data.num_steps;
+    const D drift = Ops::set((data.risk_free_rate - 0.5 * data.volatility * data.volatility) * dt);
+    const D diffusion = Ops::set(data.volatility * std::sqrt(dt));
+    const D spot = Ops::set(data.initial_price);
+    const int num_steps = data.num_steps;
+
+    for (std::int64_t first = first_path; first < first_path + count; first += Ops::kWidth) {
+        const vmath::PhiloxLanes<Ops> rng(seed, static_cast<std::uint64_t>(first));
+        D log_price = Ops::set(0.0);
+        T* column = matrix + first;
+        for (int step = 0; step < num_steps; step += 2) {
+            D u1, u2, z[2];
+            rng.uniforms(static_cast<std::uint32_t>(step / 2), u1, u2);
+            vmath::box_muller<Ops>(u1, u2, z[0], z[1]);
+            for (int half = 0; half < 2 && step + half < num_steps; ++half) {
+                log_price = Ops::add(log_price, Ops::add(drift, Ops::mul(diffusion, z[half])));
+                if ((step + half + 1) % steps_per_row == 0) {
+                    alignas(64) double lanes[Ops::kWidth];
+                    Ops::store(lanes, Ops::mul(spot, vmath::exp<Ops>(log_price)));
+                    T* target = column + static_cast<std::int64_t>((step + half + 1) / steps_per_row - 1) * stride;
+                    for (int lane = 0; lane < Ops::kWidth; ++lane) {
+                        target[lane] = static_cast<T>(lanes[lane]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Discounts cashflow[0 .. count) by `discount` in place and returns the regression
+// sums of the in-the-money paths of `row` (sign = +1 call, -1 put).
+// count is rounded up to whole groups of 8 (padded arrays); lanes >= count are masked.
+template <class Ops, class T>
+RegressionSums lsm_regression_sums(const T* row, double* cashflow, std::int64_t count, double strike,
+                                   double sign, double discount, int basis) {
+    using D = typename Ops::Double;
+    constexpr int kVectorsPerGroup = kKernelGroup / Ops::kWidth;
+    const D inverse_strike = Ops::set(1.0 / strike);
+    const D strike_d = Ops::set(strike);
+    const D sign_d = Ops::set(sign);
+    const D discount_d = Ops::set(discount);
+    const D zero = Ops::set(0.0);
+    const D one = Ops::set(1.0);
+    const D count_d = Ops::set(static_cast<double>(count));
+
+    D moment[kVectorsPerGroup][2 * kMaxLsmBasis - 1];
+    D target[kVectorsPerGroup][kMaxLsmBasis];
+    D paths[kVectorsPerGroup];
+    for (int v = 0; v < kVectorsPerGroup; ++v) {
+        for (int k = 0; k < 2 * kMaxLsmBasis - 1; ++k) {
+            moment[v][k] = zero;
+        }
+        for (int k = 0; k < kMaxLsmBasis; ++k) {
+            target[v][k] = zero;
+        }
+        paths[v] = zero;
+    }
+
+    for (std::int64_t group = 0; group < count; group += kKernelGroup) {
+        for (int v = 0; v < kVectorsPerGroup; ++v) {
+            const std::int64_t p = group + v * Ops::kWidth;
+            const D price = kernel_detail::load_row<Ops>(row + p);
+            const D y = Ops::mul(Ops::load(cashflow + p), discount_d);
+            Ops::store(cashflow + p, y);
+
+            const D lane = Ops::add(Ops::set(static_cast<double>(p)), Ops::load(kernel_detail::kLaneIndex));
+            const D exercise = Ops::mul(sign_d, Ops::sub(price, strike_d));
+            // In the money and a real path: 1, else 0.
+            const D weight = Ops::select(Ops::less(lane, count_d), Ops::select(Ops::greater(exercise, zero), one, zero), zero);
+            const D x = Ops::mul(price, inverse_strike);
+
+            D power = weight;  // weight * x^k
+            for (int k = 0; k < 2 * basis - 1; ++k) {
+                moment[v][k] = Ops::add(moment[v][k], power);
+                if (k < basis) {
+                    target[v][k] = Ops::add(target[v][k], Ops::mul(power, y));
+                }
+                power = Ops::mul(power, x);
+            }
+            paths[v] = Ops::add(paths[v], weight);
+        }
+    }
+
+    // Lane k of the group accumulators holds path k mod 8, as in the path kernels.
+    RegressionSums result{};
+    alignas(64) double lanes[kKernelGroup];
+    for (int k = 0; k < 2 * basis - 1; ++k) {
+        for (int v = 0; v < kVectorsPerGroup; ++v) {
+            Ops::store(lanes + v * Ops::kWidth, moment[v][k]);
+        }
+        result.moment[k] = kernel_detail::combine_group<Ops>(lanes);
+    }
+    for (int k = 0; k < basis; ++k) {
+        for (int v = 0; v < kVectorsPerGroup; ++v) {
+            Ops::store(lanes + v * Ops::kWidth, target[v][k]);
+        }
+        result.target[k] = kernel_detail::combine_group<Ops>(lanes);
+    }
+    for (int v = 0; v < kVectorsPerGroup; ++v) {
+        Ops::store(lanes + v * Ops::kWidth, paths[v]);
+    }
+    result.paths = static_cast<std::int64_t>(kernel_detail::combine_group<Ops>(lanes));
+    return result;
+}
+
+// Exercises where the payoff beats the regressed continuation value
+// sum_k coefficients[k] x^k: cashflow = payoff on those paths, unchanged elsewhere.
+template <class Ops, class T>
+void lsm_exercise(const T* row, double* cashflow, std::int64_t count, double strike, double sign,
+                  const double* coefficients, int basis) {
+    using D = typename Ops::Double;
+    const D inverse_strike = Ops::set(1.0 / strike);
+    const D strike_d = Ops::set(strike);
+    const D sign_d = Ops::set(sign);
+    const D zero = Ops::set(0.0);
+    for (std::int64_t p = 0; p < count; p += Ops::kWidth) {
+        const D price = kernel_detail::load_row<Ops>(row + p);
+        const D x = Ops::mul(price, inverse_strike);
+        D continuation = Ops::set(coefficients[basis - 1]);
+        for (int k = basis - 2; k >= 0; --k) {
+            continuation = Ops::add(Ops::mul(continuation, x), Ops::set(coefficients[k]));
+        }
+        const D exercise = Ops::mul(sign_d, Ops::sub(price, strike_d));
+        const auto in_the_money = Ops::greater(exercise, zero);
+        const D value = Ops::select(Ops::greater(exercise, continuation), exercise, Ops::load(cashflow + p));
+        Ops::store(cashflow + p, Ops::select(in_the_money, value, Ops::load(cashflow + p)));
+    }
+}
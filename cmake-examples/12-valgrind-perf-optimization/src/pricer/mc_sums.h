@@ -0,0 +1,80 @@
+// src/pricer/mc_sums.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Per-block sums accumulated by the Monte Carlo kernels, and the fixed-order
+// reduction that combines them. Each engine sums its own kind of block.
+
+// Payoff sums of one block of paths.
+struct BlockSums {
+    double payoff = 0.0;
+    double payoff_sq = 0.0;
+    std::int64_t paths = 0;
+};
+
+inline BlockSums operator+(const BlockSums& a, const BlockSums& b) {
+    return {a.payoff + b.payoff, a.payoff_sq + b.payoff_sq, a.paths + b.paths};
+}
+
+// Sums of one block of samples for the control-variate estimator (adaptive_engine.h).
+// y is the sample payoff (the pair average with antithetic variates), x the control,
+// plain the payoff of the first path alone, for comparison with plain Monte Carlo.
+struct ControlSums {
+    double y = 0.0;
+    double y_sq = 0.0;
+    double x = 0.0;
+    double x_sq = 0.0;
+    double xy = 0.0;
+    double plain = 0.0;
+    double plain_sq = 0.0;
+    std::int64_t samples = 0;
+};
+
+inline ControlSums operator+(const ControlSums& a, const ControlSums& b) {
+    return {a.y + b.y, a.y_sq + b.y_sq, a.x + b.x, a.x_sq + b.x_sq, a.xy + b.xy,
+            a.plain + b.plain, a.plain_sq + b.plain_sq, a.samples + b.samples};
+}
+
+// Per-path estimators accumulated by simulate_greeks_block() (greeks_engine.h),
+// undiscounted; the index into GreekSums.
+enum GreekEstimator : int {
+    kGreekPrice,
+    kDeltaPathwise,
+    kDeltaLikelihoodRatio,
+    kGammaMixed,            // likelihood ratio applied to the pathwise delta
+    kGammaLikelihoodRatio,
+    kVegaPathwise,
+    kVegaLikelihoodRatio,
+    kRhoPathwise,
+    kGreekEstimatorCount
+};
+
+struct GreekSums {
+    double sum[kGreekEstimatorCount];
+    double sum_sq[kGreekEstimatorCount];
+    std::int64_t paths;
+};
+
+inline GreekSums operator+(const GreekSums& a, const GreekSums& b) {
+    GreekSums result{};
+    for (int i = 0; i < kGreekEstimatorCount; ++i) {
+        result.sum[i] = a.sum[i] + b.sum[i];
+        result.sum_sq[i] = a.sum_sq[i] + b.sum_sq[i];
+    }
+    result.paths = a.paths + b.paths;
+    return result;
+}
+
+// Sums blocks pairwise in index order: a fixed summation tree whatever the thread
+// count, with O(log n) rounding error growth instead of O(n) for a running sum.
+template <class Sums>
+Sums pairwise_sum(const std::vector<Sums>& blocks, std::size_t begin, std::size_t end) {
+    if (end - begin == 1) {
+        return blocks[begin];
+    }
+    const std::size_t middle = begin + (end - begin) / 2;
+    return pairwise_sum(blocks, begin, middle) + pairwise_sum(blocks, middle, end);
+}
@@ -0,0 +1,34 @@
+// src/pricer/memory_usage.cpp
+#include "pricer/memory_usage.h"
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(__GLIBC__)
+    #include <malloc.h>
+#endif
+
+std::size_t peak_rss_bytes() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            std::istringstream fields(line.substr(6));
+            std::size_t kilobytes = 0;
+            fields >> kilobytes;
+            return kilobytes * 1024;
+        }
+    }
+    return 0;
+}
+
+bool reset_peak_rss() {
+#if defined(__GLIBC__)
+    // Give freed heap memory back first, or it would count as resident.
+    malloc_trim(0);
+#endif
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+    clear_refs.flush();
+    return static_cast<bool>(clear_refs);
+}
@@ -0,0 +1,13 @@
+// src/pricer/memory_usage.h
+#pragma once
+
+#include <cstddef>
+
+// Peak resident set size of this process in bytes (VmHWM in /proc/self/status),
+// or 0 where that is not available.
+std::size_t peak_rss_bytes();
+
+// Lowers the peak to the current resident set size (Linux 4.0+; freed heap memory is
+// returned to the system first where the C library allows it), so that the next
+// peak_rss_bytes() measures only what runs in between. Returns false if not supported.
+bool reset_peak_rss();
@@ -0,0 +1,50 @@
+// src/pricer/option_data.h
+#pragma once
+
+#include <cstdint>
+
+// What the option pays. European styles have a closed form (black_scholes.h),
+// path-dependent ones need simulation.
+enum class OptionStyle {
+    EuropeanCall,
+    EuropeanPut,
+    ArithmeticAsianCall,  // max(average of S over the num_steps dates - K, 0)
+};
+
+// Parameters for the option and simulation
+struct OptionData {
+    double initial_price;    // S0
+    double strike_price;     // K
+    double risk_free_rate;   // r
+    double volatility;       // sigma
+    double time_to_maturity; // T in years
+    int num_simulations;
+    int num_steps;
+    OptionStyle style = OptionStyle::EuropeanCall;
+};
+
+// Path-dependent payoffs of run_monte_carlo_exotic() (simd_engine.h), with the
+// strike, rate etc. taken from OptionData. The path is observed on the num_steps
+// dates dt, 2 dt, ..., T.
+enum class PathPayoffKind {
+    ArithmeticAsian,   // max(+-(arithmetic average of S - K), 0)
+    GeometricAsian,    // max(+-(geometric average of S - K), 0)
+    UpAndOut,          // vanilla, worthless once S >= barrier on a date
+    UpAndIn,           // vanilla, only if S >= barrier on some date
+    DownAndOut,        // vanilla, worthless once S <= barrier on a date
+    DownAndIn,         // vanilla, only if S <= barrier on some date
+    FloatingLookback,  // call S_T - min(S), put max(S) - S_T, S0 included; no strike
+};
+
+struct PathPayoff {
+    PathPayoffKind kind = PathPayoffKind::ArithmeticAsian;
+    bool call = true;
+    double barrier = 0.0;  // barrier kinds only
+};
+
+// Monte Carlo estimate together with its statistical error.
+struct McResult {
+    double price = 0.0;      // discounted mean payoff
+    double std_error = 0.0;  // standard error of `price`
+    std::int64_t paths = 0;  // simulated paths
+};
@@ -0,0 +1,61 @@
+// src/pricer/parallel_engine.cpp
+#include "pricer/parallel_engine.h"
+#include "pricer/parallel_for.h"
+#include "pricer/philox.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+BlockSums simulate_block(const OptionData& data, std::uint64_t seed, std::int64_t first_path, std::int64_t count) {
+    const double dt = data.time_to_maturity / data.num_steps;
+    const double drift = (data.risk_free_rate - 0.5 * data.volatility * data.volatility) * dt;
+    const double diffusion = data.volatility * std::sqrt(dt);
+
+    BlockSums sums;
+    for (std::int64_t i = first_path; i < first_path + count; ++i) {
+        PathRng rng(seed, static_cast<std::uint64_t>(i));
+        double current_price = data.initial_price;
+        for (int j = 0; j < data.num_steps; ++j) {
+            current_price *= std::exp(drift + diffusion * rng.next_normal());
+        }
+        const double payoff = std::max(current_price - data.strike_price, 0.0);
+        sums.payoff += payoff;
+        sums.payoff_sq += payoff * payoff;
+    }
+    sums.paths = count;
+    return sums;
+}
+
+} // namespace
+
+McResult finish_result(const OptionData& data, const BlockSums& total) {
+    McResult result;
+    result.paths = total.paths;
+    if (total.paths == 0) {
+        return result;
+    }
+    const double n = static_cast<double>(total.paths);
+    const double discount = std::exp(-data.risk_free_rate * data.time_to_maturity);
+    const double mean = total.payoff / n;
+    const double variance = total.paths > 1 ? std::max(0.0, (total.payoff_sq - n * mean * mean) / (n - 1.0)) : 0.0;
+    result.price = discount * mean;
+    result.std_error = discount * std::sqrt(variance / n);
+    return result;
+}
+
+McResult run_monte_carlo_parallel(const OptionData& data, std::uint64_t seed, unsigned num_threads) {
+    const std::int64_t total_paths = data.num_simulations;
+    if (total_paths <= 0) {
+        return McResult{};
+    }
+    const auto num_blocks = static_cast<std::size_t>((total_paths + kPathsPerBlock - 1) / kPathsPerBlock);
+    std::vector<BlockSums> blocks(num_blocks);
+
+    parallel_for(num_blocks, num_threads, [&](std::size_t block) {
+        const std::int64_t first = static_cast<std::int64_t>(block) * kPathsPerBlock;
+        blocks[block] = simulate_block(data, seed, first, std::min(kPathsPerBlock, total_paths - first));
+    });
+
+    return finish_result(data, pairwise_sum(blocks, 0, num_blocks));
+}
@@ -0,0 +1,18 @@
+// src/pricer/parallel_engine.h
+#pragma once
+
+#include "pricer/mc_sums.h"
+#include "pricer/option_data.h"
+#include <cstdint>
+
+// Paths per work block. Blocks, not threads, are the unit of summation, so the
+// reduction order only depends on num_simulations.
+constexpr std::int64_t kPathsPerBlock = 1024;
+
+// Discounted price and standard error from the sums of all paths.
+McResult finish_result(const OptionData& data, const BlockSums& total);
+
+// European call priced on `num_threads` threads (0 = all cores).
+// Path i always uses Philox stream (seed, i), so for a given seed the price is
+// bit-identical for every thread count.
+McResult run_monte_carlo_parallel(const OptionData& data, std::uint64_t seed, unsigned num_threads = 0);
@@ -0,0 +1,35 @@
+// src/pricer/parallel_for.h
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// Runs task(0) ... task(num_tasks - 1) on `num_threads` threads (0 = all cores).
+// Tasks are handed out dynamically, so which thread runs a task is not fixed:
+// for reproducible results every task must write to its own output slot.
+template <typename Task>
+void parallel_for(std::size_t num_tasks, unsigned num_threads, Task&& task) {
+    if (num_threads == 0) {
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    num_threads = static_cast<unsigned>(std::min<std::size_t>(num_threads, num_tasks));
+
+    std::atomic<std::size_t> next{0};
+    auto worker = [&] {
+        for (std::size_t i = next.fetch_add(1); i < num_tasks; i = next.fetch_add(1)) {
+            task(i);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 1; t < num_threads; ++t) {
+        threads.emplace_back(worker);
+    }
+    worker();  // the calling thread works too
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
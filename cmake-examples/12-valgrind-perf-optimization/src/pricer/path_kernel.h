@@ -0,0 +1,317 @@
+// src/pricer/path_kernel.h
+#pragma once
+
+#include "pricer/mc_sums.h"
+#include "pricer/option_data.h"
+#include "pricer/payoffs.h"
+#include "pricer/vector_math.h"
+#include <cmath>
+#include <cstdint>
+
+// Paths are accumulated in groups of 8 whatever the vector width: path k of a
+// group always adds into accumulator k, and the 8 accumulators are combined in a
+// fixed order. Scalar, AVX2 (2 x 4 lanes) and AVX-512 (1 x 8 lanes) therefore
+// add the same numbers in the same order.
+constexpr int kKernelGroup = 8;
+
+namespace kernel_detail {
+
+// A template (instantiated per Ops) rather than an inline function: see vector_math.h.
+template <class Ops>
+double combine_group(const double* values) {
+    return ((values[0] + values[1]) + (values[2] + values[3])) + ((values[4] + values[5]) + (values[6] + values[7]));
+}
+
+} // namespace kernel_detail
+
+// Any payoff policy of payoffs.h over paths [first_path, first_path + count) with
+// Ops::kWidth paths per vector. The log price is accumulated over the steps and the
+// policy keeps its running statistics in registers; European payoffs exponentiate
+// once at maturity, which in exact arithmetic equals multiplying by exp() each step
+// and replaces num_steps exp() calls with one.
+// Payoff is a template parameter so observe() is inlined into the step loop.
+template <class Ops, class Payoff>
+BlockSums simulate_payoff_block(const OptionData& data, const Payoff& payoff, std::uint64_t seed,
+                                std::int64_t first_path, std::int64_t count) {
+    using D = typename Ops::Double;
+    constexpr int kVectorsPerGroup = kKernelGroup / Ops::kWidth;
+    static_assert(kKernelGroup % Ops::kWidth == 0, "vector width must divide the group size");
+
+    const double dt = data.time_to_maturity / data.num_steps;
+    const D drift = Ops::set((data.risk_free_rate - 0.5 * data.volatility * data.volatility) * dt);
+    const D diffusion = Ops::set(data.volatility * std::sqrt(dt));
+    const D zero = Ops::set(0.0);
+    const int num_steps = data.num_steps;
+
+    double sum[kKernelGroup] = {};
+    double sum_sq[kKernelGroup] = {};
+
+    for (std::int64_t group = first_path; group < first_path + count; group += kKernelGroup) {
+        alignas(64) double values[kKernelGroup];
+        for (int v = 0; v < kVectorsPerGroup; ++v) {
+            const vmath::PhiloxLanes<Ops> rng(seed, static_cast<std::uint64_t>(group + v * Ops::kWidth));
+            typename Payoff::State state = payoff.start();
+            D log_price = zero;
+            for (int step = 0; step < num_steps; step += 2) {
+                D u1, u2, z0, z1;
+                rng.uniforms(static_cast<std::uint32_t>(step / 2), u1, u2);
+                vmath::box_muller<Ops>(u1, u2, z0, z1);
+                log_price = Ops::add(log_price, Ops::add(drift, Ops::mul(diffusion, z0)));
+                payoff.observe(state, log_price);
+                if (step + 1 < num_steps) {
+                    log_price = Ops::add(log_price, Ops::add(drift, Ops::mul(diffusion, z1)));
+                    payoff.observe(state, log_price);
+                }
+            }
+            Ops::store(values + v * Ops::kWidth, payoff.finish(state, log_price));
+        }
+
+        const std::int64_t valid = first_path + count - group;  // the last group may be partial
+        for (int k = 0; k < kKernelGroup && k < valid; ++k) {
+            sum[k] += values[k];
+            sum_sq[k] += values[k] * values[k];
+        }
+    }
+
+    return BlockSums{kernel_detail::combine_group<Ops>(sum), kernel_detail::combine_group<Ops>(sum_sq), count};
+}
+
+// European call.
+template <class Ops>
+BlockSums simulate_european_block(const OptionData& data, std::uint64_t seed,
+                                  std::int64_t first_path, std::int64_t count) {
+    const payoffs::European<Ops> payoff = payoffs::European<Ops>::make(data, PathPayoff{});
+    return simulate_payoff_block<Ops>(data, payoff, seed, first_path, count);
+}
+
+// Path-dependent payoff chosen at run time: one switch per block, the step loop
+// itself is compiled separately for every policy.
+template <class Ops>
+BlockSums simulate_path_payoff_block(const OptionData& data, const PathPayoff& payoff, std::uint64_t seed,
+                                     std::int64_t first_path, std::int64_t count) {
+    using namespace payoffs;
+    switch (payoff.kind) {
+        case PathPayoffKind::ArithmeticAsian:
+            return simulate_payoff_block<Ops>(data, ArithmeticAsian<Ops>::make(data, payoff), seed, first_path, count);
+        case PathPayoffKind::GeometricAsian:
+            return simulate_payoff_block<Ops>(data, GeometricAsian<Ops>::make(data, payoff), seed, first_path, count);
+        case PathPayoffKind::UpAndOut:
+            return simulate_payoff_block<Ops>(data, Barrier<Ops, true, true>::make(data, payoff), seed, first_path, count);
+        case PathPayoffKind::UpAndIn:
+            return simulate_payoff_block<Ops>(data, Barrier<Ops, true, false>::make(data, payoff), seed, first_path, count);
+        case PathPayoffKind::DownAndOut:
+            return simulate_payoff_block<Ops>(data, Barrier<Ops, false, true>::make(data, payoff), seed, first_path, count);
+        case PathPayoffKind::DownAndIn:
+            return simulate_payoff_block<Ops>(data, Barrier<Ops, false, false>::make(data, payoff), seed, first_path, count);
+        case PathPayoffKind::FloatingLookback:
+            return simulate_payoff_block<Ops>(data, FloatingLookback<Ops>::make(data, payoff), seed, first_path, count);
+    }
+    return BlockSums{0.0, 0.0, count};
+}
+
+// European call samples for the adaptive engine: y is the payoff, x the terminal
+// price (the control variate, E[x] = S0 e^{rT}).
+// Only the sum of the normals is accumulated per path, since
+// log(S_T / S0) = (r - sigma^2/2) T + sigma sqrt(dt) * sum(z). The antithetic path
+// (-z) then costs one more exp() and no extra random numbers.
+template <class Ops>
+ControlSums simulate_european_control_block(const OptionData& data, std::uint64_t seed,
+                                            std::int64_t first_path, std::int64_t count, bool antithetic) {
+    using D = typename Ops::Double;
+    constexpr int kVectorsPerGroup = kKernelGroup / Ops::kWidth;
+
+    const double dt = data.time_to_maturity / data.num_steps;
+    const D mean_log = Ops::set((data.risk_free_rate - 0.5 * data.volatility * data.volatility) * data.time_to_maturity);
+    const D diffusion = Ops::set(data.volatility * std::sqrt(dt));
+    const D spot = Ops::set(data.initial_price);
+    const D strike = Ops::set(data.strike_price);
+    const D zero = Ops::set(0.0);
+    const D half = Ops::set(0.5);
+    const int num_steps = data.num_steps;
+
+    double y[kKernelGroup] = {}, y_sq[kKernelGroup] = {}, x[kKernelGroup] = {}, x_sq[kKernelGroup] = {};
+    double xy[kKernelGroup] = {}, plain[kKernelGroup] = {}, plain_sq[kKernelGroup] = {};
+
+    for (std::int64_t group = first_path; group < first_path + count; group += kKernelGroup) {
+        alignas(64) double sample_y[kKernelGroup];
+        alignas(64) double sample_x[kKernelGroup];
+        alignas(64) double sample_plain[kKernelGroup];
+        for (int v = 0; v < kVectorsPerGroup; ++v) {
+            const vmath::PhiloxLanes<Ops> rng(seed, static_cast<std::uint64_t>(group + v * Ops::kWidth));
+            D z_sum = zero;
+            for (int step = 0; step < num_steps; step += 2) {
+                D u1, u2, z0, z1;
+                rng.uniforms(static_cast<std::uint32_t>(step / 2), u1, u2);
+                vmath::box_muller<Ops>(u1, u2, z0, z1);
+                z_sum = Ops::add(z_sum, z0);
+                if (step + 1 < num_steps) {
+                    z_sum = Ops::add(z_sum, z1);
+                }
+            }
+            const D shock = Ops::mul(diffusion, z_sum);
+            const D terminal = Ops::mul(spot, vmath::exp<Ops>(Ops::add(mean_log, shock)));
+            const D payoff = Ops::max(Ops::sub(terminal, strike), zero);
+            D sample_payoff = payoff;
+            D sample_terminal = terminal;
+            if (antithetic) {
+                const D mirrored = Ops::mul(spot, vmath::exp<Ops>(Ops::sub(mean_log, shock)));
+                const D mirrored_payoff = Ops::max(Ops::sub(mirrored, strike), zero);
+                sample_payoff = Ops::mul(half, Ops::add(payoff, mirrored_payoff));
+                sample_terminal = Ops::mul(half, Ops::add(terminal, mirrored));
+            }
+            Ops::store(sample_y + v * Ops::kWidth, sample_payoff);
+            Ops::store(sample_x + v * Ops::kWidth, sample_terminal);
+            Ops::store(sample_plain + v * Ops::kWidth, payoff);
+        }
+
+        const std::int64_t valid = first_path + count - group;
+        for (int k = 0; k < kKernelGroup && k < valid; ++k) {
+            y[k] += sample_y[k];
+            y_sq[k] += sample_y[k] * sample_y[k];
+            x[k] += sample_x[k];
+            x_sq[k] += sample_x[k] * sample_x[k];
+            xy[k] += sample_x[k] * sample_y[k];
+            plain[k] += sample_plain[k];
+            plain_sq[k] += sample_plain[k] * sample_plain[k];
+        }
+    }
+
+    using kernel_detail::combine_group;
+    return ControlSums{combine_group<Ops>(y), combine_group<Ops>(y_sq), combine_group<Ops>(x),
+                       combine_group<Ops>(x_sq), combine_group<Ops>(xy), combine_group<Ops>(plain),
+                       combine_group<Ops>(plain_sq), count};
+}
+
+// European call or put (data.style) with its Greeks, in one pass. As in the control
+// kernel only sum(z) is needed per path: W_T = sqrt(dt) sum(z), Z = W_T / sqrt(T) and
+// S_T = S0 exp((r - sigma^2/2) T + sigma W_T). With s = +1 (call) or -1 (put) and
+// itm = 1 if s (S_T - K) > 0:
+//   pathwise  delta = s itm S_T / S0          vega = s itm S_T (W_T - sigma T)    rho = s itm K T
+//   LR        delta = payoff Z / (S0 sigma sqrt(T))
+//             vega  = payoff ((Z^2 - 1) / sigma - Z sqrt(T))
+//             gamma = payoff ((Z^2 - 1) / (S0 sigma sqrt(T))^2 - Z / (S0^2 sigma sqrt(T)))
+//   mixed     gamma = s itm S_T / S0^2 (Z / (sigma sqrt(T)) - 1)   (LR on the pathwise delta)
+// Pathwise estimators need a payoff that is continuous in the parameter, LR ones only
+// the density, at the price of a larger variance.
+template <class Ops>
+GreekSums simulate_greeks_block(const OptionData& data, std::uint64_t seed, std::int64_t first_path, std::int64_t count) {
+    using D = typename Ops::Double;
+    constexpr int kVectorsPerGroup = kKernelGroup / Ops::kWidth;
+
+    const double maturity = data.time_to_maturity;
+    const double sigma = data.volatility;
+    const double sqrt_t = std::sqrt(maturity);
+    const D mean_log = Ops::set((data.risk_free_rate - 0.5 * sigma * sigma) * maturity);
+    const D sqrt_dt = Ops::set(std::sqrt(maturity / data.num_steps));
+    const D inverse_sqrt_t = Ops::set(1.0 / sqrt_t);
+    const D vol = Ops::set(sigma);
+    const D vol_t = Ops::set(sigma * maturity);
+    const D spot = Ops::set(data.initial_price);
+    const D inverse_spot = Ops::set(1.0 / data.initial_price);
+    const D strike = Ops::set(data.strike_price);
+    const D sign = Ops::set(data.style == OptionStyle::EuropeanPut ? -1.0 : 1.0);
+    const D strike_t = Ops::set(data.strike_price * maturity);
+    const D score_delta = Ops::set(1.0 / (data.initial_price * sigma * sqrt_t));        // per unit Z
+    const D inverse_vol_sqrt_t = Ops::set(1.0 / (sigma * sqrt_t));
+    const D inverse_vol = Ops::set(1.0 / sigma);
+    const D sqrt_t_d = Ops::set(sqrt_t);
+    const D one = Ops::set(1.0);
+    const D zero = Ops::set(0.0);
+    const int num_steps = data.num_steps;
+
+    double sum[kGreekEstimatorCount][kKernelGroup] = {};
+    double sum_sq[kGreekEstimatorCount][kKernelGroup] = {};
+
+    for (std::int64_t group = first_path; group < first_path + count; group += kKernelGroup) {
+        alignas(64) double values[kGreekEstimatorCount][kKernelGroup];
+        for (int v = 0; v < kVectorsPerGroup; ++v) {
+            const vmath::PhiloxLanes<Ops> rng(seed, static_cast<std::uint64_t>(group + v * Ops::kWidth));
+            D z_sum = zero;
+            for (int step = 0; step < num_steps; step += 2) {
+                D u1, u2, z0, z1;
+                rng.uniforms(static_cast<std::uint32_t>(step / 2), u1, u2);
+                vmath::box_muller<Ops>(u1, u2, z0, z1);
+                z_sum = Ops::add(z_sum, z0);
+                if (step + 1 < num_steps) {
+                    z_sum = Ops::add(z_sum, z1);
+                }
+            }
+            const D w = Ops::mul(sqrt_dt, z_sum);
+            const D z = Ops::mul(w, inverse_sqrt_t);
+            const D terminal = Ops::mul(spot, vmath::exp<Ops>(Ops::add(mean_log, Ops::mul(vol, w))));
+            const D intrinsic = Ops::mul(sign, Ops::sub(terminal, strike));
+            const D payoff = Ops::max(intrinsic, zero);
+            const D signed_itm = Ops::select(Ops::greater(intrinsic, zero), sign, zero);
+            const D relative = Ops::mul(signed_itm, Ops::mul(terminal, inverse_spot));   // s itm S_T / S0
+            const D z_sq_minus_one = Ops::sub(Ops::mul(z, z), one);
+
+            double* lane = &values[0][0] + v * Ops::kWidth;
+            Ops::store(lane + kGreekPrice * kKernelGroup, payoff);
+            Ops::store(lane + kDeltaPathwise * kKernelGroup, relative);
+            Ops::store(lane + kDeltaLikelihoodRatio * kKernelGroup, Ops::mul(payoff, Ops::mul(z, score_delta)));
+            Ops::store(lane + kGammaMixed * kKernelGroup,
+                       Ops::mul(Ops::mul(relative, inverse_spot), Ops::sub(Ops::mul(z, inverse_vol_sqrt_t), one)));
+            Ops::store(lane + kGammaLikelihoodRatio * kKernelGroup,
+                       Ops::mul(payoff, Ops::sub(Ops::mul(z_sq_minus_one, Ops::mul(score_delta, score_delta)),
+                                                 Ops::mul(z, Ops::mul(score_delta, inverse_spot)))));
+            Ops::store(lane + kVegaPathwise * kKernelGroup,
+                       Ops::mul(Ops::mul(signed_itm, terminal), Ops::sub(w, vol_t)));
+            Ops::store(lane + kVegaLikelihoodRatio * kKernelGroup,
+                       Ops::mul(payoff, Ops::sub(Ops::mul(z_sq_minus_one, inverse_vol), Ops::mul(z, sqrt_t_d))));
+            Ops::store(lane + kRhoPathwise * kKernelGroup, Ops::mul(signed_itm, strike_t));
+        }
+
+        const std::int64_t valid = first_path + count - group;
+        for (int g = 0; g < kGreekEstimatorCount; ++g) {
+            for (int k = 0; k < kKernelGroup && k < valid; ++k) {
+                sum[g][k] += values[g][k];
+                sum_sq[g][k] += values[g][k] * values[g][k];
+            }
+        }
+    }
+
+    GreekSums result{};
+    for (int g = 0; g < kGreekEstimatorCount; ++g) {
+        result.sum[g] = kernel_detail::combine_group<Ops>(sum[g]);
+        result.sum_sq[g] = kernel_detail::combine_group<Ops>(sum_sq[g]);
+    }
+    result.paths = count;
+    return result;
+}
+
+// Arithmetic average of S over the num_steps monitoring dates of each path
+// [first_path, first_path + count), written to averages[0 .. count).
+// Unlike the European kernels this needs S at every step: one vector exp per step.
+template <class Ops>
+void simulate_average_block(const OptionData& data, std::uint64_t seed,
+                            std::int64_t first_path, std::int64_t count, double* averages) {
+    using D = typename Ops::Double;
+    const double dt = data.time_to_maturity / data.num_steps;
+    const D drift = Ops::set((data.risk_free_rate - 0.5 * data.volatility * data.volatility) * dt);
+    const D diffusion = Ops::set(data.volatility * std::sqrt(dt));
+    const D spot = Ops::set(data.initial_price);
+    const D inverse_steps = Ops::set(1.0 / data.num_steps);
+    const int num_steps = data.num_steps;
+
+    for (std::int64_t first = first_path; first < first_path + count; first += Ops::kWidth) {
+        const vmath::PhiloxLanes<Ops> rng(seed, static_cast<std::uint64_t>(first));
+        D log_price = Ops::set(0.0);
+        D price_sum = Ops::set(0.0);
+        for (int step = 0; step < num_steps; step += 2) {
+            D u1, u2, z0, z1;
+            rng.uniforms(static_cast<std::uint32_t>(step / 2), u1, u2);
+            vmath::box_muller<Ops>(u1, u2, z0, z1);
+            log_price = Ops::add(log_price, Ops::add(drift, Ops::mul(diffusion, z0)));
+            price_sum = Ops::add(price_sum, vmath::exp<Ops>(log_price));
+            if (step + 1 < num_steps) {
+                log_price = Ops::add(log_price, Ops::add(drift, Ops::mul(diffusion, z1)));
+                price_sum = Ops::add(price_sum, vmath::exp<Ops>(log_price));
+            }
+        }
+        alignas(64) double lanes[Ops::kWidth];
+        Ops::store(lanes, Ops::mul(spot, Ops::mul(price_sum, inverse_steps)));
+        for (int lane = 0; lane < Ops::kWidth && first + lane < first_path + count; ++lane) {
+            averages[first + lane - first_path] = lanes[lane];
+        }
+    }
+}
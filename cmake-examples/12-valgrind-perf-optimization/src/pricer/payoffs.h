@@ -0,0 +1,132 @@
+// src/pricer/payoffs.h
+#pragma once
+
+#include "pricer/option_data.h"
+#include "pricer/vector_math.h"
+#include <cfloat>
+#include <cmath>
+
+// Payoff policies for simulate_payoff_block() (path_kernel.h).
+//
+// The kernel advances the log price x_t = log(S_t / S0) of Ops::kWidth paths and
+// calls, per policy P:
+//   P::State state = payoff.start();          // per-path running statistics
+//   payoff.observe(state, x);                 // on every monitoring date
+//   D value = payoff.finish(state, x_T);      // undiscounted payoff
+// State holds a few vectors, so it lives in registers: nothing of the path is stored
+// and nothing is allocated per path. Since log is monotonic, extremes and barrier
+// crossings are tracked on x directly; only the arithmetic average needs exp() per step.
+//
+// Every policy is a template on Ops, see the note in vector_math.h.
+// P::make(data, payoff) builds the policy with its constants broadcast once.
+namespace payoffs {
+
+template <class Ops>
+struct European {
+    using D = typename Ops::Double;
+    struct State {};
+
+    D spot, strike, sign, zero;
+
+    static European make(const OptionData& data, const PathPayoff& payoff) {
+        return European{Ops::set(data.initial_price), Ops::set(data.strike_price),
+                        Ops::set(payoff.call ? 1.0 : -1.0), Ops::set(0.0)};
+    }
+    State start() const { return State{}; }
+    void observe(State&, D) const {}
+    D finish(const State&, D log_price) const {
+        const D terminal = Ops::mul(spot, vmath::exp<Ops>(log_price));
+        return Ops::max(Ops::mul(sign, Ops::sub(terminal, strike)), zero);
+    }
+};
+
+template <class Ops>
+struct ArithmeticAsian {
+    using D = typename Ops::Double;
+    struct State { D price_sum; };
+
+    D spot, strike, sign, inverse_steps, zero;
+
+    static ArithmeticAsian make(const OptionData& data, const PathPayoff& payoff) {
+        return ArithmeticAsian{Ops::set(data.initial_price), Ops::set(data.strike_price),
+                               Ops::set(payoff.call ? 1.0 : -1.0), Ops::set(1.0 / data.num_steps), Ops::set(0.0)};
+    }
+    State start() const { return State{zero}; }
+    void observe(State& state, D log_price) const {
+        state.price_sum = Ops::add(state.price_sum, vmath::exp<Ops>(log_price));
+    }
+    D finish(const State& state, D) const {
+        const D average = Ops::mul(spot, Ops::mul(state.price_sum, inverse_steps));
+        return Ops::max(Ops::mul(sign, Ops::sub(average, strike)), zero);
+    }
+};
+
+template <class Ops>
+struct GeometricAsian {
+    using D = typename Ops::Double;
+    struct State { D log_sum; };
+
+    D spot, strike, sign, inverse_steps, zero;
+
+    static GeometricAsian make(const OptionData& data, const PathPayoff& payoff) {
+        return GeometricAsian{Ops::set(data.initial_price), Ops::set(data.strike_price),
+                              Ops::set(payoff.call ? 1.0 : -1.0), Ops::set(1.0 / data.num_steps), Ops::set(0.0)};
+    }
+    State start() const { return State{zero}; }
+    void observe(State& state, D log_price) const { state.log_sum = Ops::add(state.log_sum, log_price); }
+    D finish(const State& state, D) const {
+        const D average = Ops::mul(spot, vmath::exp<Ops>(Ops::mul(state.log_sum, inverse_steps)));
+        return Ops::max(Ops::mul(sign, Ops::sub(average, strike)), zero);
+    }
+};
+
+// Discretely monitored barrier on a vanilla call or put. kUp: the barrier is above
+// the spot and the running maximum is tracked, otherwise the minimum.
+template <class Ops, bool kUp, bool kKnockOut>
+struct Barrier {
+    using D = typename Ops::Double;
+    struct State { D extreme; };
+
+    European<Ops> vanilla;
+    D log_barrier, zero, start_extreme;
+
+    static Barrier make(const OptionData& data, const PathPayoff& payoff) {
+        return Barrier{European<Ops>::make(data, payoff), Ops::set(std::log(payoff.barrier / data.initial_price)),
+                       Ops::set(0.0), Ops::set(kUp ? -DBL_MAX : DBL_MAX)};
+    }
+    State start() const { return State{start_extreme}; }
+    void observe(State& state, D log_price) const {
+        state.extreme = kUp ? Ops::max(state.extreme, log_price) : Ops::min(state.extreme, log_price);
+    }
+    D finish(const State& state, D log_price) const {
+        const D value = vanilla.finish(typename European<Ops>::State{}, log_price);
+        // Not touched: max < barrier (up) or min > barrier (down).
+        const auto untouched = kUp ? Ops::less(state.extreme, log_barrier) : Ops::greater(state.extreme, log_barrier);
+        return kKnockOut ? Ops::select(untouched, value, zero) : Ops::select(untouched, zero, value);
+    }
+};
+
+// Floating strike: the call is struck at the minimum, the put at the maximum.
+template <class Ops>
+struct FloatingLookback {
+    using D = typename Ops::Double;
+    struct State { D minimum, maximum; };
+
+    D spot, sign, zero;
+
+    static FloatingLookback make(const OptionData& data, const PathPayoff& payoff) {
+        return FloatingLookback{Ops::set(data.initial_price), Ops::set(payoff.call ? 1.0 : -1.0), Ops::set(0.0)};
+    }
+    State start() const { return State{zero, zero}; }  // S0 is part of the extremes
+    void observe(State& state, D log_price) const {
+        state.minimum = Ops::min(state.minimum, log_price);
+        state.maximum = Ops::max(state.maximum, log_price);
+    }
+    D finish(const State& state, D log_price) const {
+        const D extreme = Ops::select(Ops::greater(sign, zero), state.minimum, state.maximum);
+        const D terminal = vmath::exp<Ops>(log_price);
+        return Ops::mul(spot, Ops::mul(sign, Ops::sub(terminal, vmath::exp<Ops>(extreme))));
+    }
+};
+
+} // namespace payoffs
@@ -0,0 +1,91 @@
+// src/pricer/philox.h
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+// Philox4x32-10 counter-based random number generator (Salmon et al., "Parallel
+// Random Numbers: As Easy as 1, 2, 3", SC11).
+//
+// A counter-based generator has no state that advances: output = f(counter, key).
+// With counter = (step, path) every path owns an independent stream that any thread
+// can compute directly, so results do not depend on how paths are split across threads.
+// std::mt19937 would have to be jumped ahead or shared, and sharing makes the
+// draw order depend on thread scheduling.
+namespace philox {
+
+using Counter = std::array<std::uint32_t, 4>;
+using Key = std::array<std::uint32_t, 2>;
+
+constexpr std::uint32_t kMultiplier0 = 0xD2511F53u;
+constexpr std::uint32_t kMultiplier1 = 0xCD9E8D57u;
+constexpr std::uint32_t kWeyl0 = 0x9E3779B9u;  // golden ratio
+constexpr std::uint32_t kWeyl1 = 0xBB67AE85u;  // sqrt(3) - 1
+constexpr int kRounds = 10;
+
+inline Counter round(const Counter& x, const Key& key) {
+    const std::uint64_t product0 = static_cast<std::uint64_t>(kMultiplier0) * x[0];
+    const std::uint64_t product1 = static_cast<std::uint64_t>(kMultiplier1) * x[2];
+    const auto hi0 = static_cast<std::uint32_t>(product0 >> 32);
+    const auto lo0 = static_cast<std::uint32_t>(product0);
+    const auto hi1 = static_cast<std::uint32_t>(product1 >> 32);
+    const auto lo1 = static_cast<std::uint32_t>(product1);
+    return {hi1 ^ x[1] ^ key[0], lo1, hi0 ^ x[3] ^ key[1], lo0};
+}
+
+inline Counter generate(Counter counter, Key key) {
+    for (int i = 0; i < kRounds; ++i) {
+        counter = round(counter, key);
+        key[0] += kWeyl0;
+        key[1] += kWeyl1;
+    }
+    return counter;
+}
+
+inline Key make_key(std::uint64_t seed) {
+    return {static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)};
+}
+
+// Counter of draw block `block` of path `path`.
+inline Counter make_counter(std::uint64_t path, std::uint32_t block) {
+    return {block, 0u, static_cast<std::uint32_t>(path), static_cast<std::uint32_t>(path >> 32)};
+}
+
+// Uniform in (0, 1) from 52 random bits: never exactly 0 or 1, so log(u) is finite.
+inline double to_uniform(std::uint32_t hi, std::uint32_t lo) {
+    const std::uint64_t bits = (static_cast<std::uint64_t>(hi) << 20) ^ (lo >> 12);
+    return (static_cast<double>(bits) + 0.5) * 0x1.0p-52;
+}
+
+} // namespace philox
+
+// Standard normal draws for one Monte Carlo path.
+// Each Philox block gives two uniforms, Box-Muller turns them into two normals,
+// so draw 2k and 2k+1 of a path always come from counter block k.
+class PathRng {
+public:
+    PathRng(std::uint64_t seed, std::uint64_t path) : key_(philox::make_key(seed)), path_(path) {}
+
+    double next_normal() {
+        if (has_spare_) {
+            has_spare_ = false;
+            return spare_;
+        }
+        const philox::Counter bits = philox::generate(philox::make_counter(path_, block_++), key_);
+        const double u1 = philox::to_uniform(bits[0], bits[1]);
+        const double u2 = philox::to_uniform(bits[2], bits[3]);
+        const double radius = std::sqrt(-2.0 * std::log(u1));
+        const double angle = 2.0 * M_PI * u2;
+        spare_ = radius * std::sin(angle);
+        has_spare_ = true;
+        return radius * std::cos(angle);
+    }
+
+private:
+    philox::Key key_;
+    std::uint64_t path_;
+    std::uint32_t block_ = 0;
+    double spare_ = 0.0;
+    bool has_spare_ = false;
+};
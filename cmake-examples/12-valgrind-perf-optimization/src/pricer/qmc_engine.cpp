@@ -0,0 +1,136 @@
+// src/pricer/qmc_engine.cpp
+#include "pricer/qmc_engine.h"
+#include "pricer/black_scholes.h"
+#include "pricer/brownian_bridge.h"
+#include "pricer/parallel_engine.h"
+#include "pricer/parallel_for.h"
+#include "pricer/payoffs.h"
+#include "pricer/simd_ops_scalar.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+struct QmcPlan {
+    const OptionData& data;
+    const QmcConfig& config;
+    const SobolDirections& directions;
+    const BrownianBridge& bridge;
+    int replicates;
+    std::int64_t points;       // per replicate
+    std::int64_t first_point;  // 1 without scrambling
+};
+
+template <class Payoff>
+BlockSums simulate_qmc_block(const QmcPlan& plan, const Payoff& payoff, int replicate,
+                             std::int64_t first, std::int64_t count) {
+    const OptionData& data = plan.data;
+    const int num_steps = data.num_steps;
+    const double dt = data.time_to_maturity / num_steps;
+    const double drift = (data.risk_free_rate - 0.5 * data.volatility * data.volatility) * dt;
+    const double diffusion = data.volatility * std::sqrt(dt);
+
+    SobolSequence sequence(plan.directions, plan.config.scrambling,
+                           plan.config.seed + static_cast<std::uint64_t>(replicate) * 0x9E3779B97F4A7C15ull);
+    sequence.skip_to(static_cast<std::uint64_t>(plan.first_point + first));
+
+    std::vector<double> point(static_cast<std::size_t>(num_steps));
+    std::vector<double> path(static_cast<std::size_t>(num_steps));
+    BlockSums sums{0.0, 0.0, count};
+    for (std::int64_t i = 0; i < count; ++i) {
+        sequence.next(point.data());
+        for (double& u : point) {
+            u = inverse_normal_cdf(u);
+        }
+
+        typename Payoff::State state = payoff.start();
+        double log_price = 0.0;
+        if (plan.config.brownian_bridge) {
+            plan.bridge.build(point.data(), path.data());  // W(t_i) / sqrt(dt)
+            for (int step = 0; step < num_steps; ++step) {
+                log_price = drift * (step + 1) + diffusion * path[static_cast<std::size_t>(step)];
+                payoff.observe(state, log_price);
+            }
+        } else {
+            for (int step = 0; step < num_steps; ++step) {
+                log_price += drift + diffusion * point[static_cast<std::size_t>(step)];
+                payoff.observe(state, log_price);
+            }
+        }
+        const double value = payoff.finish(state, log_price);
+        sums.payoff += value;
+        sums.payoff_sq += value * value;
+    }
+    return sums;
+}
+
+template <class Payoff>
+McResult run_qmc(const OptionData& data, const Payoff& payoff, const QmcConfig& config) {
+    if (data.num_simulations <= 0) {
+        return McResult{};
+    }
+    if (config.replicates < 1) {
+        throw std::invalid_argument("run_monte_carlo_qmc: replicates must be at least 1");
+    }
+    const bool scrambled = config.scrambling != SobolScrambling::None;
+    const int replicates = scrambled ? config.replicates : 1;
+    const std::int64_t points = std::max<std::int64_t>(1, data.num_simulations / replicates);
+
+    const SobolDirections directions(data.num_steps);
+    const BrownianBridge bridge(data.num_steps);
+    const QmcPlan plan{data, config, directions, bridge, replicates, points, scrambled ? 0 : 1};
+
+    const auto blocks_per_replicate = static_cast<std::size_t>((points + kPathsPerBlock - 1) / kPathsPerBlock);
+    std::vector<BlockSums> blocks(blocks_per_replicate * static_cast<std::size_t>(replicates));
+    parallel_for(blocks.size(), config.num_threads, [&](std::size_t task) {
+        const int replicate = static_cast<int>(task / blocks_per_replicate);
+        const std::int64_t first = static_cast<std::int64_t>(task % blocks_per_replicate) * kPathsPerBlock;
+        blocks[task] = simulate_qmc_block(plan, payoff, replicate, first, std::min(kPathsPerBlock, points - first));
+    });
+
+    // One estimate per replicate; they are independent, so their spread is the error.
+    const double discount = std::exp(-data.risk_free_rate * data.time_to_maturity);
+    double sum = 0.0;
+    double sum_sq = 0.0;
+    for (int r = 0; r < replicates; ++r) {
+        const std::size_t begin = static_cast<std::size_t>(r) * blocks_per_replicate;
+        const BlockSums total = pairwise_sum(blocks, begin, begin + blocks_per_replicate);
+        const double estimate = discount * total.payoff / static_cast<double>(total.paths);
+        sum += estimate;
+        sum_sq += estimate * estimate;
+    }
+
+    McResult result;
+    const double n = replicates;
+    result.price = sum / n;
+    result.std_error = replicates > 1 ? std::sqrt(std::max(0.0, (sum_sq - n * result.price * result.price) / (n - 1.0)) / n) : 0.0;
+    result.paths = points * replicates;
+    return result;
+}
+
+} // namespace
+
+McResult run_monte_carlo_qmc(const OptionData& data, const QmcConfig& config) {
+    PathPayoff vanilla;
+    vanilla.call = data.style != OptionStyle::EuropeanPut;
+    if (data.style == OptionStyle::ArithmeticAsianCall) {
+        return run_qmc(data, payoffs::ArithmeticAsian<ScalarOps>::make(data, vanilla), config);
+    }
+    return run_qmc(data, payoffs::European<ScalarOps>::make(data, vanilla), config);
+}
+
+McResult run_monte_carlo_qmc(const OptionData& data, const PathPayoff& payoff, const QmcConfig& config) {
+    using namespace payoffs;
+    switch (payoff.kind) {
+        case PathPayoffKind::ArithmeticAsian:  return run_qmc(data, ArithmeticAsian<ScalarOps>::make(data, payoff), config);
+        case PathPayoffKind::GeometricAsian:   return run_qmc(data, GeometricAsian<ScalarOps>::make(data, payoff), config);
+        case PathPayoffKind::UpAndOut:         return run_qmc(data, Barrier<ScalarOps, true, true>::make(data, payoff), config);
+        case PathPayoffKind::UpAndIn:          return run_qmc(data, Barrier<ScalarOps, true, false>::make(data, payoff), config);
+        case PathPayoffKind::DownAndOut:       return run_qmc(data, Barrier<ScalarOps, false, true>::make(data, payoff), config);
+        case PathPayoffKind::DownAndIn:        return run_qmc(data, Barrier<ScalarOps, false, false>::make(data, payoff), config);
+        case PathPayoffKind::FloatingLookback: return run_qmc(data, FloatingLookback<ScalarOps>::make(data, payoff), config);
+    }
+    throw std::invalid_argument("run_monte_carlo_qmc: unknown payoff");
+}
@@ -0,0 +1,32 @@
+// src/pricer/qmc_engine.h
+#pragma once
+
+#include "pricer/option_data.h"
+#include "pricer/sobol.h"
+#include <cstdint>
+
+// Settings of run_monte_carlo_qmc().
+struct QmcConfig {
+    // Independent scramblings of the sequence; num_simulations is split evenly
+    // between them and the spread of their estimates gives std_error.
+    int replicates = 16;
+    SobolScrambling scrambling = SobolScrambling::Owen;
+    bool brownian_bridge = true;   // otherwise coordinate i drives step i
+    std::uint64_t seed = 42;
+    unsigned num_threads = 0;      // 0 = all cores
+};
+
+// Randomized quasi-Monte Carlo: one Sobol point of num_steps coordinates per path,
+// mapped to normals by inverse_normal_cdf() and to a path by the Brownian bridge.
+// On smooth payoffs the error falls close to O(1/N) instead of O(1/sqrt(N)).
+//
+// Every replicate is split into blocks of consecutive indices; each block starts with
+// a Gray-code skip-ahead, so threads generate disjoint ranges of the same sequence.
+// The result is the same for any thread count.
+// Without scrambling there is a single replicate (the first point, all zeros, is
+// skipped) and std_error is 0: the error of unrandomized QMC cannot be estimated.
+//
+// European call or put according to data.style.
+McResult run_monte_carlo_qmc(const OptionData& data, const QmcConfig& config = {});
+// Path-dependent payoff, as run_monte_carlo_exotic() (simd_engine.h).
+McResult run_monte_carlo_qmc(const OptionData& data, const PathPayoff& payoff, const QmcConfig& config = {});
@@ -0,0 +1,73 @@
+// src/pricer/reference_engine.cpp
+#include "pricer/reference_engine.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+McResult finish_reference(const OptionData& data, double total_payoff, double total_payoff_sq) {
+    const double n = data.num_simulations;
+    const double discount = std::exp(-data.risk_free_rate * data.time_to_maturity);
+    const double mean = total_payoff / n;
+    McResult result;
+    result.price = discount * mean;
+    result.std_error = discount * std::sqrt((total_payoff_sq / n - mean * mean) / (n - 1.0));
+    result.paths = data.num_simulations;
+    return result;
+}
+
+// BAD: a new generator, seeded from the OS, for every single number.
+double generate_normal_random() {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::normal_distribution<> d(0.0, 1.0);
+    return d(gen);
+}
+
+} // namespace
+
+McResult run_monte_carlo_naive(const OptionData& data) {
+    double total_payoff = 0.0;
+    double total_payoff_sq = 0.0;
+    double dt = data.time_to_maturity / data.num_steps;
+    double drift = (data.risk_free_rate - 0.5 * data.volatility * data.volatility) * dt;
+    double diffusion = data.volatility * std::sqrt(dt);
+
+    for (int i = 0; i < data.num_simulations; ++i) {
+        // BAD: the whole path on the heap, grown one push_back at a time.
+        std::vector<double> path;
+        path.push_back(data.initial_price);
+        for (int j = 0; j < data.num_steps; ++j) {
+            double epsilon = generate_normal_random();
+            path.push_back(path.back() * std::exp(drift + diffusion * epsilon));
+        }
+        double payoff = std::max(path.back() - data.strike_price, 0.0);
+        total_payoff += payoff;
+        total_payoff_sq += payoff * payoff;
+    }
+    return finish_reference(data, total_payoff, total_payoff_sq);
+}
+
+McResult run_monte_carlo_sequential(const OptionData& data, std::uint64_t seed) {
+    std::mt19937 gen(static_cast<std::mt19937::result_type>(seed));
+    std::normal_distribution<> dist(0.0, 1.0);
+    double total_payoff = 0.0;
+    double total_payoff_sq = 0.0;
+    double dt = data.time_to_maturity / data.num_steps;
+    double drift = (data.risk_free_rate - 0.5 * data.volatility * data.volatility) * dt;
+    double diffusion = data.volatility * std::sqrt(dt);
+
+    for (int i = 0; i < data.num_simulations; ++i) {
+        double current_price = data.initial_price;
+        for (int j = 0; j < data.num_steps; ++j) {
+            double epsilon = dist(gen);
+            current_price *= std::exp(drift + diffusion * epsilon);
+        }
+        double payoff = std::max(current_price - data.strike_price, 0.0);
+        total_payoff += payoff;
+        total_payoff_sq += payoff * payoff;
+    }
+    return finish_reference(data, total_payoff, total_payoff_sq);
+}
@@ -0,0 +1,15 @@
+// src/pricer/reference_engine.h
+#pragma once
+
+#include "pricer/option_data.h"
+#include <cstdint>
+
+// The single-threaded loops of the tutorial executables, with a standard error,
+// as baselines for the benchmark suite. European call only.
+
+// option_pricer_naive: a std::vector per path and a freshly seeded std::mt19937
+// (from std::random_device) per normal. Not reproducible.
+McResult run_monte_carlo_naive(const OptionData& data);
+
+// option_pricer_optimized: one std::mt19937 + std::normal_distribution, one std::exp per step.
+McResult run_monte_carlo_sequential(const OptionData& data, std::uint64_t seed);
@@ -0,0 +1,96 @@
+// src/pricer/simd_engine.cpp
+#include "pricer/simd_engine.h"
+#include "pricer/parallel_engine.h"
+#include "pricer/parallel_for.h"
+#include "pricer/simd_kernels.h"
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+// Splits the paths into fixed blocks, runs simulate_block(first, count) for each on
+// the thread pool and reduces pairwise in block order.
+template <class SimulateBlock>
+McResult run_blocks(const OptionData& data, unsigned num_threads, SimulateBlock simulate_block) {
+    const std::int64_t total_paths = data.num_simulations;
+    if (total_paths <= 0) {
+        return McResult{};
+    }
+    const auto num_blocks = static_cast<std::size_t>((total_paths + kPathsPerBlock - 1) / kPathsPerBlock);
+    std::vector<BlockSums> blocks(num_blocks);
+
+    parallel_for(num_blocks, num_threads, [&](std::size_t block) {
+        const std::int64_t first = static_cast<std::int64_t>(block) * kPathsPerBlock;
+        blocks[block] = simulate_block(first, std::min(kPathsPerBlock, total_paths - first));
+    });
+
+    return finish_result(data, pairwise_sum(blocks, 0, num_blocks));
+}
+
+} // namespace
+
+const char* simd_isa_name(SimdIsa isa) {
+    switch (isa) {
+        case SimdIsa::Scalar: return "scalar";
+        case SimdIsa::Avx2:   return "avx2";
+        case SimdIsa::Avx512: return "avx512";
+    }
+    return "unknown";
+}
+
+bool is_simd_isa_supported(SimdIsa isa) {
+    switch (isa) {
+        case SimdIsa::Scalar: return true;
+#ifdef PRICER_SIMD_X86
+        case SimdIsa::Avx2:   return __builtin_cpu_supports("avx2");
+        case SimdIsa::Avx512: return __builtin_cpu_supports("avx512f");
+#endif
+        default:              return false;
+    }
+}
+
+SimdIsa best_simd_isa() {
+    for (SimdIsa isa : {SimdIsa::Avx512, SimdIsa::Avx2}) {
+        if (is_simd_isa_supported(isa)) {
+            return isa;
+        }
+    }
+    return SimdIsa::Scalar;
+}
+
+const SimdKernels& simd_kernels(SimdIsa isa) {
+    if (!is_simd_isa_supported(isa)) {
+        return kScalarKernels;
+    }
+    switch (isa) {
+#ifdef PRICER_SIMD_X86
+        case SimdIsa::Avx2:   return kAvx2Kernels;
+        case SimdIsa::Avx512: return kAvx512Kernels;
+#endif
+        default:              return kScalarKernels;
+    }
+}
+
+McResult run_monte_carlo_simd(const OptionData& data, std::uint64_t seed, unsigned num_threads) {
+    return run_monte_carlo_simd(data, seed, num_threads, best_simd_isa());
+}
+
+McResult run_monte_carlo_simd(const OptionData& data, std::uint64_t seed, unsigned num_threads, SimdIsa isa) {
+    const auto kernel = simd_kernels(isa).european;
+    return run_blocks(data, num_threads, [&](std::int64_t first, std::int64_t count) {
+        return kernel(data, seed, first, count);
+    });
+}
+
+McResult run_monte_carlo_exotic(const OptionData& data, const PathPayoff& payoff, std::uint64_t seed,
+                                unsigned num_threads) {
+    return run_monte_carlo_exotic(data, payoff, seed, num_threads, best_simd_isa());
+}
+
+McResult run_monte_carlo_exotic(const OptionData& data, const PathPayoff& payoff, std::uint64_t seed,
+                                unsigned num_threads, SimdIsa isa) {
+    const auto kernel = simd_kernels(isa).path_payoff;
+    return run_blocks(data, num_threads, [&](std::int64_t first, std::int64_t count) {
+        return kernel(data, payoff, seed, first, count);
+    });
+}
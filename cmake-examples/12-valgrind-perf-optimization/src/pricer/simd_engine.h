@@ -0,0 +1,33 @@
+// src/pricer/simd_engine.h
+#pragma once
+
+#include "pricer/option_data.h"
+#include "pricer/simd_kernels.h"
+#include <cstdint>
+
+enum class SimdIsa {
+    Scalar,   // the vector kernel with one lane
+    Avx2,     // 4 paths per instruction
+    Avx512,   // 8 paths per instruction
+};
+
+const char* simd_isa_name(SimdIsa isa);
+bool is_simd_isa_supported(SimdIsa isa);
+SimdIsa best_simd_isa();
+
+// Kernels for `isa`, or the scalar ones if the CPU does not support it.
+const SimdKernels& simd_kernels(SimdIsa isa);
+
+// European call with the vectorized path kernel (Philox + Box-Muller + exp, all SIMD),
+// parallelized like run_monte_carlo_parallel().
+// Every ISA returns the same bits, for any thread count; the values differ from
+// run_monte_carlo_parallel() by rounding only, as that one uses libm per step.
+McResult run_monte_carlo_simd(const OptionData& data, std::uint64_t seed, unsigned num_threads = 0);
+McResult run_monte_carlo_simd(const OptionData& data, std::uint64_t seed, unsigned num_threads, SimdIsa isa);
+
+// Path-dependent payoff (Asian, barrier, lookback; see PathPayoff) with the same
+// vectorized kernel, paths and determinism as run_monte_carlo_simd().
+McResult run_monte_carlo_exotic(const OptionData& data, const PathPayoff& payoff, std::uint64_t seed,
+                                unsigned num_threads = 0);
+McResult run_monte_carlo_exotic(const OptionData& data, const PathPayoff& payoff, std::uint64_t seed,
+                                unsigned num_threads, SimdIsa isa);
@@ -0,0 +1,24 @@
+// src/pricer/simd_kernel_avx2.cpp
+#include "pricer/simd_kernels.h"
+#include "pricer/basket_kernel.h"
+#include "pricer/black_scholes_kernel.h"
+#include "pricer/lsm_kernel.h"
+#include "pricer/path_kernel.h"
+#include "pricer/simd_ops_avx2.h"
+
+// Compiled with -mavx2 (see CMakeLists.txt); only called after a CPU check.
+const SimdKernels kAvx2Kernels = {
+    simulate_european_block<Avx2Ops>,
+    simulate_path_payoff_block<Avx2Ops>,
+    simulate_european_control_block<Avx2Ops>,
+    simulate_greeks_block<Avx2Ops>,
+    simulate_basket_block<Avx2Ops>,
+    simulate_average_block<Avx2Ops>,
+    simulate_path_rows<Avx2Ops, double>,
+    simulate_path_rows<Avx2Ops, float>,
+    lsm_regression_sums<Avx2Ops, double>,
+    lsm_regression_sums<Avx2Ops, float>,
+    lsm_exercise<Avx2Ops, double>,
+    lsm_exercise<Avx2Ops, float>,
+    black_scholes_batch<Avx2Ops>,
+};
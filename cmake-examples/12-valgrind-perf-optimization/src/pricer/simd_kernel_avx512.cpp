@@ -0,0 +1,24 @@
+// src/pricer/simd_kernel_avx512.cpp
+#include "pricer/simd_kernels.h"
+#include "pricer/basket_kernel.h"
+#include "pricer/black_scholes_kernel.h"
+#include "pricer/lsm_kernel.h"
+#include "pricer/path_kernel.h"
+#include "pricer/simd_ops_avx512.h"
+
+// Compiled with -mavx512f (see CMakeLists.txt); only called after a CPU check.
+const SimdKernels kAvx512Kernels = {
+    simulate_european_block<Avx512Ops>,
+    simulate_path_payoff_block<Avx512Ops>,
+    simulate_european_control_block<Avx512Ops>,
+    simulate_greeks_block<Avx512Ops>,
+    simulate_basket_block<Avx512Ops>,
+    simulate_average_block<Avx512Ops>,
+    simulate_path_rows<Avx512Ops, double>,
+    simulate_path_rows<Avx512Ops, float>,
+    lsm_regression_sums<Avx512Ops, double>,
+    lsm_regression_sums<Avx512Ops, float>,
+    lsm_exercise<Avx512Ops, double>,
+    lsm_exercise<Avx512Ops, float>,
+    black_scholes_batch<Avx512Ops>,
+};
@@ -0,0 +1,23 @@
+// src/pricer/simd_kernel_scalar.cpp
+#include "pricer/simd_kernels.h"
+#include "pricer/basket_kernel.h"
+#include "pricer/black_scholes_kernel.h"
+#include "pricer/lsm_kernel.h"
+#include "pricer/path_kernel.h"
+#include "pricer/simd_ops_scalar.h"
+
+const SimdKernels kScalarKernels = {
+    simulate_european_block<ScalarOps>,
+    simulate_path_payoff_block<ScalarOps>,
+    simulate_european_control_block<ScalarOps>,
+    simulate_greeks_block<ScalarOps>,
+    simulate_basket_block<ScalarOps>,
+    simulate_average_block<ScalarOps>,
+    simulate_path_rows<ScalarOps, double>,
+    simulate_path_rows<ScalarOps, float>,
+    lsm_regression_sums<ScalarOps, double>,
+    lsm_regression_sums<ScalarOps, float>,
+    lsm_exercise<ScalarOps, double>,
+    lsm_exercise<ScalarOps, float>,
+    black_scholes_batch<ScalarOps>,
+};
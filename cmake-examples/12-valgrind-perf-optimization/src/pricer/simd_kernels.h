@@ -0,0 +1,43 @@
+// src/pricer/simd_kernels.h
+#pragma once
+
+#include "pricer/basket_kernel.h"
+#include "pricer/black_scholes_kernel.h"
+#include "pricer/lsm_kernel.h"
+#include "pricer/mc_sums.h"
+#include "pricer/option_data.h"
+#include <cstdint>
+
+// The path kernels of path_kernel.h instantiated for one instruction set.
+// Each table is defined in its own translation unit so it can be compiled with
+// that instruction set enabled; get one through simd_kernels() (simd_engine.h),
+// which checks the CPU first.
+struct SimdKernels {
+    BlockSums (*european)(const OptionData& data, std::uint64_t seed, std::int64_t first_path, std::int64_t count);
+    BlockSums (*path_payoff)(const OptionData& data, const PathPayoff& payoff, std::uint64_t seed,
+                             std::int64_t first_path, std::int64_t count);
+    ControlSums (*european_control)(const OptionData& data, std::uint64_t seed, std::int64_t first_path,
+                                    std::int64_t count, bool antithetic);
+    GreekSums (*greeks)(const OptionData& data, std::uint64_t seed, std::int64_t first_path, std::int64_t count);
+    BlockSums (*basket)(const BasketModel& model, std::uint64_t seed, std::int64_t first_path, std::int64_t count);
+    void (*arithmetic_averages)(const OptionData& data, std::uint64_t seed, std::int64_t first_path,
+                                std::int64_t count, double* averages);
+    // Longstaff-Schwartz, for double and float path matrices (lsm_kernel.h).
+    void (*path_rows)(const OptionData& data, std::uint64_t seed, std::int64_t first_path, std::int64_t count,
+                      int steps_per_row, double* matrix, std::int64_t stride);
+    void (*path_rows_float)(const OptionData& data, std::uint64_t seed, std::int64_t first_path, std::int64_t count,
+                            int steps_per_row, float* matrix, std::int64_t stride);
+    RegressionSums (*lsm_regression)(const double* row, double* cashflow, std::int64_t count, double strike,
+                                     double sign, double discount, int basis);
+    RegressionSums (*lsm_regression_float)(const float* row, double* cashflow, std::int64_t count, double strike,
+                                           double sign, double discount, int basis);
+    void (*lsm_exercise)(const double* row, double* cashflow, std::int64_t count, double strike, double sign,
+                         const double* coefficients, int basis);
+    void (*lsm_exercise_float)(const float* row, double* cashflow, std::int64_t count, double strike, double sign,
+                               const double* coefficients, int basis);
+    void (*black_scholes)(const BlackScholesBatch& batch, std::size_t count, double* prices);
+};
+
+extern const SimdKernels kScalarKernels;
+extern const SimdKernels kAvx2Kernels;
+extern const SimdKernels kAvx512Kernels;
@@ -0,0 +1,47 @@
+// src/pricer/simd_ops_avx2.h
+#pragma once
+
+// Only include from translation units compiled with -mavx2.
+#include <immintrin.h>
+#include <cstdint>
+
+// Four double lanes; integer lanes are the matching four 64-bit lanes.
+struct Avx2Ops {
+    static constexpr int kWidth = 4;
+    using Double = __m256d;
+    using Word = __m256i;
+    using Mask = __m256d;
+
+    static Double set(double value) { return _mm256_set1_pd(value); }
+    static Double load(const double* source) { return _mm256_loadu_pd(source); }
+    static void store(double* target, Double value) { _mm256_storeu_pd(target, value); }
+
+    static Double add(Double a, Double b) { return _mm256_add_pd(a, b); }
+    static Double sub(Double a, Double b) { return _mm256_sub_pd(a, b); }
+    static Double mul(Double a, Double b) { return _mm256_mul_pd(a, b); }
+    static Double div(Double a, Double b) { return _mm256_div_pd(a, b); }
+    static Double sqrt(Double a) { return _mm256_sqrt_pd(a); }
+    static Double min(Double a, Double b) { return _mm256_min_pd(a, b); }
+    static Double max(Double a, Double b) { return _mm256_max_pd(a, b); }
+    static Double round(Double a) { return _mm256_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+    static Mask greater(Double a, Double b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+    static Mask less(Double a, Double b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    static Mask equal(Double a, Double b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+    static Double select(Mask mask, Double if_true, Double if_false) { return _mm256_blendv_pd(if_false, if_true, mask); }
+
+    static Word set_word(std::uint64_t value) { return _mm256_set1_epi64x(static_cast<long long>(value)); }
+    static Word iota_word(std::uint64_t first) {
+        return _mm256_add_epi64(set_word(first), _mm256_setr_epi64x(0, 1, 2, 3));
+    }
+    static Word add_word(Word a, Word b) { return _mm256_add_epi64(a, b); }
+    static Word and_word(Word a, Word b) { return _mm256_and_si256(a, b); }
+    static Word or_word(Word a, Word b) { return _mm256_or_si256(a, b); }
+    static Word xor_word(Word a, Word b) { return _mm256_xor_si256(a, b); }
+    template <int Bits> static Word shift_left(Word a) { return _mm256_slli_epi64(a, Bits); }
+    template <int Bits> static Word shift_right(Word a) { return _mm256_srli_epi64(a, Bits); }
+    static Word mul_low32(Word a, Word b) { return _mm256_mul_epu32(a, b); }
+
+    static Word bits(Double a) { return _mm256_castpd_si256(a); }
+    static Double from_bits(Word a) { return _mm256_castsi256_pd(a); }
+};
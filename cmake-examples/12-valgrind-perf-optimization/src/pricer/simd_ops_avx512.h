@@ -0,0 +1,47 @@
+// src/pricer/simd_ops_avx512.h
+#pragma once
+
+// Only include from translation units compiled with -mavx512f.
+#include <immintrin.h>
+#include <cstdint>
+
+// Eight double lanes; integer lanes are the matching eight 64-bit lanes.
+struct Avx512Ops {
+    static constexpr int kWidth = 8;
+    using Double = __m512d;
+    using Word = __m512i;
+    using Mask = __mmask8;
+
+    static Double set(double value) { return _mm512_set1_pd(value); }
+    static Double load(const double* source) { return _mm512_loadu_pd(source); }
+    static void store(double* target, Double value) { _mm512_storeu_pd(target, value); }
+
+    static Double add(Double a, Double b) { return _mm512_add_pd(a, b); }
+    static Double sub(Double a, Double b) { return _mm512_sub_pd(a, b); }
+    static Double mul(Double a, Double b) { return _mm512_mul_pd(a, b); }
+    static Double div(Double a, Double b) { return _mm512_div_pd(a, b); }
+    static Double sqrt(Double a) { return _mm512_sqrt_pd(a); }
+    static Double min(Double a, Double b) { return _mm512_min_pd(a, b); }
+    static Double max(Double a, Double b) { return _mm512_max_pd(a, b); }
+    static Double round(Double a) { return _mm512_roundscale_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+    static Mask greater(Double a, Double b) { return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ); }
+    static Mask less(Double a, Double b) { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+    static Mask equal(Double a, Double b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+    static Double select(Mask mask, Double if_true, Double if_false) { return _mm512_mask_blend_pd(mask, if_false, if_true); }
+
+    static Word set_word(std::uint64_t value) { return _mm512_set1_epi64(static_cast<long long>(value)); }
+    static Word iota_word(std::uint64_t first) {
+        return _mm512_add_epi64(set_word(first), _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7));
+    }
+    static Word add_word(Word a, Word b) { return _mm512_add_epi64(a, b); }
+    static Word and_word(Word a, Word b) { return _mm512_and_si512(a, b); }
+    static Word or_word(Word a, Word b) { return _mm512_or_si512(a, b); }
+    static Word xor_word(Word a, Word b) { return _mm512_xor_si512(a, b); }
+    template <int Bits> static Word shift_left(Word a) { return _mm512_slli_epi64(a, Bits); }
+    template <int Bits> static Word shift_right(Word a) { return _mm512_srli_epi64(a, Bits); }
+    static Word mul_low32(Word a, Word b) { return _mm512_mul_epu32(a, b); }
+
+    static Word bits(Double a) { return _mm512_castpd_si512(a); }
+    static Double from_bits(Word a) { return _mm512_castsi512_pd(a); }
+};
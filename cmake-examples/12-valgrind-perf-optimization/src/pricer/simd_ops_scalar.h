@@ -0,0 +1,57 @@
+// src/pricer/simd_ops_scalar.h
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// One-lane implementation of the operations used by the vector kernels
+// (see vector_math.h). Used where AVX2 is not available, and as the reference
+// the vector instantiations must match bit for bit.
+struct ScalarOps {
+    static constexpr int kWidth = 1;
+    using Double = double;
+    using Word = std::uint64_t;   // 64-bit lane
+    using Mask = bool;
+
+    static Double set(double value) { return value; }
+    static Double load(const double* source) { return *source; }
+    static void store(double* target, Double value) { *target = value; }
+
+    static Double add(Double a, Double b) { return a + b; }
+    static Double sub(Double a, Double b) { return a - b; }
+    static Double mul(Double a, Double b) { return a * b; }
+    static Double div(Double a, Double b) { return a / b; }
+    static Double sqrt(Double a) { return std::sqrt(a); }
+    static Double min(Double a, Double b) { return a < b ? a : b; }  // same operand order as minpd
+    static Double max(Double a, Double b) { return a > b ? a : b; }
+    static Double round(Double a) { return std::nearbyint(a); }
+
+    static Mask greater(Double a, Double b) { return a > b; }
+    static Mask less(Double a, Double b) { return a < b; }
+    static Mask equal(Double a, Double b) { return a == b; }
+    static Double select(Mask mask, Double if_true, Double if_false) { return mask ? if_true : if_false; }
+
+    static Word set_word(std::uint64_t value) { return value; }
+    // Lane i holds first + i.
+    static Word iota_word(std::uint64_t first) { return first; }
+    static Word add_word(Word a, Word b) { return a + b; }
+    static Word and_word(Word a, Word b) { return a & b; }
+    static Word or_word(Word a, Word b) { return a | b; }
+    static Word xor_word(Word a, Word b) { return a ^ b; }
+    template <int Bits> static Word shift_left(Word a) { return a << Bits; }
+    template <int Bits> static Word shift_right(Word a) { return a >> Bits; }
+    // Low 32 bits of a times low 32 bits of b, full 64-bit product.
+    static Word mul_low32(Word a, Word b) { return (a & 0xFFFFFFFFu) * (b & 0xFFFFFFFFu); }
+
+    static Word bits(Double a) {
+        Word result;
+        std::memcpy(&result, &a, sizeof(result));
+        return result;
+    }
+    static Double from_bits(Word a) {
+        Double result;
+        std::memcpy(&result, &a, sizeof(result));
+        return result;
+    }
+};
@@ -0,0 +1,191 @@
+// src/pricer/sobol.cpp
+#include "pricer/sobol.h"
+#include <stdexcept>
+
+namespace {
+
+// Joe & Kuo (2008) initial direction numbers m_1..m_s of coordinates 1..12.
+constexpr std::uint32_t kInitialNumbers[][6] = {
+    {1}, {1, 3}, {1, 3, 1}, {1, 1, 1}, {1, 1, 3, 3}, {1, 3, 5, 13},
+    {1, 1, 5, 5, 17}, {1, 1, 5, 5, 5}, {1, 1, 7, 11, 19}, {1, 1, 5, 1, 1}, {1, 1, 1, 3, 11}, {1, 3, 5, 5, 31},
+};
+constexpr int kTabulated = static_cast<int>(sizeof(kInitialNumbers) / sizeof(kInitialNumbers[0]));
+
+std::uint64_t splitmix64(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+// a * b mod p over GF(2); polynomials as bit masks, degree of p <= 31.
+std::uint64_t multiply_mod(std::uint64_t a, std::uint64_t b, std::uint64_t p, int degree) {
+    std::uint64_t result = 0;
+    for (; b != 0; b >>= 1) {
+        if (b & 1) {
+            result ^= a;
+        }
+        a <<= 1;
+        if ((a >> degree) & 1) {
+            a ^= p;
+        }
+    }
+    return result;
+}
+
+std::uint64_t power_of_x_mod(std::uint64_t exponent, std::uint64_t p, int degree) {
+    std::uint64_t result = 1;
+    std::uint64_t base = degree == 1 ? (2 ^ p) : 2;  // x mod p
+    for (; exponent != 0; exponent >>= 1) {
+        if (exponent & 1) {
+            result = multiply_mod(result, base, p, degree);
+        }
+        base = multiply_mod(base, base, p, degree);
+    }
+    return result;
+}
+
+// p is primitive iff x has multiplicative order exactly 2^degree - 1 modulo p.
+bool is_primitive(std::uint64_t p, int degree) {
+    const std::uint64_t order = (1ull << degree) - 1;
+    if (power_of_x_mod(order, p, degree) != 1) {
+        return false;
+    }
+    std::uint64_t rest = order;
+    for (std::uint64_t q = 2; q * q <= rest; ++q) {
+        if (rest % q == 0) {
+            if (power_of_x_mod(order / q, p, degree) == 1) {
+                return false;
+            }
+            while (rest % q == 0) {
+                rest /= q;
+            }
+        }
+    }
+    return rest == 1 || power_of_x_mod(order / rest, p, degree) != 1;  // rest is the largest prime factor
+}
+
+std::uint32_t reverse_bits(std::uint32_t x) {
+    x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+    x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+    x = ((x >> 4) & 0x0F0F0F0Fu) | ((x & 0x0F0F0F0Fu) << 4);
+    x = ((x >> 8) & 0x00FF00FFu) | ((x & 0x00FF00FFu) << 8);
+    return (x >> 16) | (x << 16);
+}
+
+// Burley, "Practical Hash-based Owen Scrambling" (JCGT 2020): a hash in which every
+// bit only depends on the bits below it; applied to the bit-reversed coordinate it
+// permutes each digit based on all higher digits, like Owen's nested scrambling.
+std::uint32_t owen_scramble(std::uint32_t x, std::uint32_t seed) {
+    x = reverse_bits(x);
+    x += seed;
+    x ^= x * 0x6C50B47Cu;
+    x ^= x * 0xB82F1E52u;
+    x ^= x * 0xC7AFE638u;
+    x ^= x * 0x8D22F6E6u;
+    return reverse_bits(x);
+}
+
+} // namespace
+
+SobolDirections::SobolDirections(int dimensions)
+    : m_dimensions(dimensions), m_numbers(static_cast<std::size_t>(dimensions) * kBits) {
+    if (dimensions < 1) {
+        throw std::invalid_argument("SobolDirections: at least one dimension is required");
+    }
+    for (int k = 0; k < kBits; ++k) {
+        m_numbers[static_cast<std::size_t>(k)] = 1u << (kBits - 1 - k);  // van der Corput
+    }
+
+    int degree = 1;
+    std::uint64_t coefficients = 0;  // middle coefficients a_1 .. a_{s-1}, a_1 highest
+    for (int d = 1; d < dimensions; ++d) {
+        // Next primitive polynomial x^s + a_1 x^{s-1} + ... + a_{s-1} x + 1.
+        std::uint64_t polynomial = 0;
+        for (;;) {
+            if (coefficients >> (degree - 1) != 0) {
+                ++degree;
+                coefficients = 0;
+            }
+            polynomial = (1ull << degree) | (coefficients << 1) | 1u;
+            ++coefficients;
+            if (is_primitive(polynomial, degree)) {
+                break;
+            }
+        }
+        if (degree >= kBits) {
+            throw std::invalid_argument("SobolDirections: too many dimensions");
+        }
+
+        // Initial m_1..m_s (odd, m_k < 2^k), then the recurrence
+        // m_k = 2 a_1 m_{k-1} ^ 4 a_2 m_{k-2} ^ ... ^ 2^s m_{k-s} ^ m_{k-s}.
+        std::uint32_t m[kBits];
+        for (int k = 0; k < degree; ++k) {
+            if (d <= kTabulated) {
+                m[k] = kInitialNumbers[d - 1][k];
+            } else {
+                const std::uint64_t random = splitmix64((static_cast<std::uint64_t>(d) << 8) | static_cast<std::uint64_t>(k));
+                m[k] = static_cast<std::uint32_t>(random & ((1ull << (k + 1)) - 1)) | 1u;
+            }
+        }
+        const std::uint64_t a = polynomial >> 1;  // a_1 .. a_{s-1} in bits s-2 .. 0, bit s-1 is the leading 1
+        for (int k = degree; k < kBits; ++k) {
+            std::uint32_t value = m[k - degree] ^ (m[k - degree] << degree);
+            for (int i = 1; i < degree; ++i) {
+                if ((a >> (degree - 1 - i)) & 1) {
+                    value ^= m[k - i] << i;
+                }
+            }
+            m[k] = value;
+        }
+        std::uint32_t* v = &m_numbers[static_cast<std::size_t>(d) * kBits];
+        for (int k = 0; k < kBits; ++k) {
+            v[k] = m[k] << (kBits - 1 - k);
+        }
+    }
+}
+
+SobolSequence::SobolSequence(const SobolDirections& directions, SobolScrambling scrambling, std::uint64_t seed)
+    : m_directions(directions), m_scrambling(scrambling),
+      m_scramble(static_cast<std::size_t>(directions.dimensions())),
+      m_state(static_cast<std::size_t>(directions.dimensions())) {
+    for (std::size_t d = 0; d < m_scramble.size(); ++d) {
+        m_scramble[d] = static_cast<std::uint32_t>(splitmix64(seed ^ splitmix64(d)));
+    }
+    skip_to(0);
+}
+
+void SobolSequence::skip_to(std::uint64_t index) {
+    m_index = index;
+    const std::uint64_t gray = index ^ (index >> 1);
+    for (int d = 0; d < m_directions.dimensions(); ++d) {
+        const std::uint32_t* v = m_directions[d];
+        std::uint32_t x = 0;
+        for (int k = 0; k < SobolDirections::kBits; ++k) {
+            if ((gray >> k) & 1) {
+                x ^= v[k];
+            }
+        }
+        m_state[static_cast<std::size_t>(d)] = x;
+    }
+}
+
+void SobolSequence::next(double* point) {
+    const int dimensions = m_directions.dimensions();
+    for (int d = 0; d < dimensions; ++d) {
+        std::uint32_t x = m_state[static_cast<std::size_t>(d)];
+        if (m_scrambling == SobolScrambling::DigitalShift) {
+            x ^= m_scramble[static_cast<std::size_t>(d)];
+        } else if (m_scrambling == SobolScrambling::Owen) {
+            x = owen_scramble(x, m_scramble[static_cast<std::size_t>(d)]);
+        }
+        point[d] = (static_cast<double>(x) + 0.5) * 0x1.0p-32;
+    }
+
+    // Gray code: point n + 1 differs from point n in direction number ctz(n + 1).
+    ++m_index;
+    const int bit = __builtin_ctzll(m_index);
+    for (int d = 0; d < dimensions; ++d) {
+        m_state[static_cast<std::size_t>(d)] ^= m_directions[d][bit];
+    }
+}
@@ -0,0 +1,57 @@
+// src/pricer/sobol.h
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Randomization of a Sobol sequence. Randomized points stay low-discrepancy but are
+// uniformly distributed, so independent randomizations give an unbiased estimate
+// and an error bar.
+enum class SobolScrambling {
+    None,          // plain Sobol points
+    DigitalShift,  // XOR every coordinate with a random 32-bit word
+    Owen,          // nested uniform scrambling (Laine-Karras style hash, Burley 2020)
+};
+
+// Direction numbers v[d][k] of the first `dimensions` Sobol coordinates, 32 bits.
+// Coordinate 0 is the van der Corput sequence. Coordinate d >= 1 uses the d-th
+// primitive polynomial over GF(2) (by degree, then coefficients, as in Joe & Kuo);
+// the first 12 take Joe & Kuo's initial direction numbers, later ones odd
+// pseudo-random ones. Built once and shared read-only by all threads.
+class SobolDirections {
+public:
+    static constexpr int kBits = 32;
+
+    explicit SobolDirections(int dimensions);
+
+    int dimensions() const { return m_dimensions; }
+    const std::uint32_t* operator[](int dimension) const { return &m_numbers[static_cast<std::size_t>(dimension) * kBits]; }
+
+private:
+    int m_dimensions;
+    std::vector<std::uint32_t> m_numbers;  // [dimension * kBits + bit]
+};
+
+// A randomized Sobol sequence in Gray-code order: point n is the XOR of the
+// direction numbers selected by the bits of gray(n) = n ^ (n >> 1), so consecutive
+// points differ by one XOR per coordinate, and any point can be reached directly.
+class SobolSequence {
+public:
+    SobolSequence(const SobolDirections& directions, SobolScrambling scrambling, std::uint64_t seed);
+
+    // Moves to point `index` in O(dimensions * 32): the skip-ahead that lets threads
+    // generate disjoint index ranges of the same sequence.
+    void skip_to(std::uint64_t index);
+
+    // Writes the current point as uniforms in (0, 1), one per dimension, and advances.
+    void next(double* point);
+
+    std::uint64_t index() const { return m_index; }
+
+private:
+    const SobolDirections& m_directions;
+    SobolScrambling m_scrambling;
+    std::vector<std::uint32_t> m_scramble;  // per-dimension shift or hash seed
+    std::vector<std::uint32_t> m_state;     // unscrambled coordinates of point m_index
+    std::uint64_t m_index = 0;
+};
@@ -0,0 +1,234 @@
+// src/pricer/vector_math.h
+#pragma once
+
+#include "pricer/philox.h"
+#include <cstdint>
+
+// Vectorized math for the Monte Carlo kernels, written once against an "Ops" policy
+// (ScalarOps, Avx2Ops, Avx512Ops) that supplies the per-ISA intrinsics.
+//
+// Only +, -, *, /, sqrt and exact bit manipulation are used, all of which are
+// correctly rounded in IEEE 754, and the kernel files are compiled with
+// -ffp-contract=off. Every instantiation therefore returns the same bits per lane,
+// which makes prices reproducible across CPUs. Accuracy is within a few ulp of libm.
+//
+// The ISA-specific kernel files include this header with different -m flags, so it
+// must not call non-template inline functions or standard library templates: the
+// linker keeps one copy of those, possibly one compiled with AVX-512.
+namespace vmath {
+
+// Cephes minimax coefficients for sin and cos on [-pi/4, pi/4], highest power first.
+constexpr double kSinCoefficients[] = {
+    1.58962301576546568060e-10, -2.50507477628578072866e-8, 2.75573136213857245213e-6,
+    -1.98412698295895385996e-4, 8.33333333332211858878e-3, -1.66666666666666307295e-1};
+constexpr double kCosCoefficients[] = {
+    -1.13585365213876817300e-11, 2.08757008419747316778e-9, -2.75573141792967388112e-7,
+    2.48015872888517045348e-5, -1.38888888888730564116e-3, 4.16666666666665929218e-2};
+// Hart's double precision normal CDF (as given in G. West, "Better approximations
+// to cumulative normal functions", 2005), highest power first.
+constexpr double kCdfNumerator[] = {
+    3.52624965998911e-02, 0.700383064443688, 6.37396220353165, 33.912866078383,
+    112.079291497871, 221.213596169931, 220.206867912376};
+constexpr double kCdfDenominator[] = {
+    8.83883476483184e-02, 1.75566716318264, 16.064177579207, 86.7807322029461,
+    296.564248779674, 637.333633378831, 793.826512519948, 440.413735824752};
+// 1/13! ... 1/0!
+constexpr double kExpCoefficients[] = {
+    1.0 / 6227020800.0, 1.0 / 479001600.0, 1.0 / 39916800.0, 1.0 / 3628800.0, 1.0 / 362880.0,
+    1.0 / 40320.0, 1.0 / 5040.0, 1.0 / 720.0, 1.0 / 120.0, 1.0 / 24.0, 1.0 / 6.0, 0.5, 1.0, 1.0};
+
+// Integer-valued double in [0, 2^52) from the low 52 bits of each lane, exactly:
+// OR-ing the bits into the mantissa of 2^52 and subtracting 2^52.
+template <class Ops>
+inline typename Ops::Double word_to_double(typename Ops::Word word) {
+    const typename Ops::Word two52_bits = Ops::set_word(0x4330000000000000ull);
+    return Ops::sub(Ops::from_bits(Ops::or_word(word, two52_bits)), Ops::set(0x1.0p52));
+}
+
+// Natural log for x in (0, inf), normal numbers only.
+// x = m * 2^e with m in [sqrt(1/2), sqrt(2)), log(m) = 2 atanh(s), s = (m-1)/(m+1).
+template <class Ops>
+inline typename Ops::Double log(typename Ops::Double x) {
+    using D = typename Ops::Double;
+    const auto bits = Ops::bits(x);
+    const auto mantissa_mask = Ops::set_word(0x000FFFFFFFFFFFFFull);
+    const auto one_bits = Ops::set_word(0x3FF0000000000000ull);
+
+    D m = Ops::from_bits(Ops::or_word(Ops::and_word(bits, mantissa_mask), one_bits));     // [1, 2)
+    D e = Ops::sub(word_to_double<Ops>(Ops::template shift_right<52>(bits)), Ops::set(1023.0));
+
+    const auto large = Ops::greater(m, Ops::set(1.4142135623730951));
+    m = Ops::select(large, Ops::mul(m, Ops::set(0.5)), m);
+    e = Ops::select(large, Ops::add(e, Ops::set(1.0)), e);
+
+    const D s = Ops::div(Ops::sub(m, Ops::set(1.0)), Ops::add(m, Ops::set(1.0)));
+    const D z = Ops::mul(s, s);
+    // |s| <= 0.1716: the series 1 + z/3 + z^2/5 + ... to z^10 is accurate to 2^-56.
+    D series = Ops::set(1.0 / 21.0);
+    for (double odd = 19.0; odd >= 1.0; odd -= 2.0) {
+        series = Ops::add(Ops::mul(series, z), Ops::set(1.0 / odd));
+    }
+    const D log_m = Ops::mul(Ops::add(s, s), series);
+
+    // e * ln2 split into a part exact in double (hi) and the rest (lo).
+    const D ln2_hi = Ops::set(6.93147180369123816490e-01);
+    const D ln2_lo = Ops::set(1.90821492927058770002e-10);
+    return Ops::add(Ops::mul(e, ln2_hi), Ops::add(Ops::mul(e, ln2_lo), log_m));
+}
+
+// e^x, clamped to the range of normal doubles.
+// x = k ln2 + r with |r| <= ln2/2, e^x = 2^k e^r, e^r by its Taylor series.
+template <class Ops>
+inline typename Ops::Double exp(typename Ops::Double x) {
+    using D = typename Ops::Double;
+    x = Ops::max(Ops::min(x, Ops::set(709.0)), Ops::set(-708.0));
+    const D k = Ops::round(Ops::mul(x, Ops::set(1.4426950408889634)));
+    const D r = Ops::sub(Ops::sub(x, Ops::mul(k, Ops::set(6.93147180369123816490e-01))),
+                         Ops::mul(k, Ops::set(1.90821492927058770002e-10)));
+
+    // |r| <= 0.347: terms to r^13/13! reach 2^-56 relative.
+    D poly = Ops::set(kExpCoefficients[0]);
+    for (int i = 1; i < 14; ++i) {
+        poly = Ops::add(Ops::mul(poly, r), Ops::set(kExpCoefficients[i]));
+    }
+
+    // 2^k: the low bits of k + 1023 + 2^52 are the biased exponent.
+    const auto biased = Ops::bits(Ops::add(k, Ops::set(1023.0 + 0x1.0p52)));
+    const auto exponent = Ops::and_word(biased, Ops::set_word(0x7FFull));
+    return Ops::mul(poly, Ops::from_bits(Ops::template shift_left<52>(exponent)));
+}
+
+// cos and sin of 2*pi*u for u in [0, 1).
+// The quadrant is split off in u (exactly), the remainder |r| <= pi/4 goes to
+// the Cephes minimax polynomials.
+template <class Ops>
+inline void sincos_2pi(typename Ops::Double u, typename Ops::Double& cos_out, typename Ops::Double& sin_out) {
+    using D = typename Ops::Double;
+    const D t = Ops::mul(u, Ops::set(4.0));
+    const D quadrant = Ops::round(t);                                  // 0 .. 4
+    const D r = Ops::mul(Ops::sub(t, quadrant), Ops::set(1.5707963267948966));
+    const D z = Ops::mul(r, r);
+
+    D sin_poly = Ops::set(kSinCoefficients[0]);
+    for (int i = 1; i < 6; ++i) {
+        sin_poly = Ops::add(Ops::mul(sin_poly, z), Ops::set(kSinCoefficients[i]));
+    }
+    const D sin_r = Ops::add(r, Ops::mul(Ops::mul(r, z), sin_poly));
+
+    D cos_poly = Ops::set(kCosCoefficients[0]);
+    for (int i = 1; i < 6; ++i) {
+        cos_poly = Ops::add(Ops::mul(cos_poly, z), Ops::set(kCosCoefficients[i]));
+    }
+    const D cos_r = Ops::add(Ops::sub(Ops::set(1.0), Ops::mul(Ops::set(0.5), z)), Ops::mul(Ops::mul(z, z), cos_poly));
+
+    const D zero = Ops::set(0.0);
+    const D minus_sin = Ops::sub(zero, sin_r);
+    const D minus_cos = Ops::sub(zero, cos_r);
+    const auto q1 = Ops::equal(quadrant, Ops::set(1.0));
+    const auto q2 = Ops::equal(quadrant, Ops::set(2.0));
+    const auto q3 = Ops::equal(quadrant, Ops::set(3.0));
+    // quadrant 0 and 4: (cos r, sin r); 1: (-sin r, cos r); 2: (-cos r, -sin r); 3: (sin r, -cos r)
+    cos_out = Ops::select(q1, minus_sin, Ops::select(q2, minus_cos, Ops::select(q3, sin_r, cos_r)));
+    sin_out = Ops::select(q1, cos_r, Ops::select(q2, minus_sin, Ops::select(q3, minus_cos, sin_r)));
+}
+
+// Standard normal CDF, absolute error below 1e-13, relative error below 1e-8 in the
+// tail (|x| >= 7.07). Both of Hart's branches are
+// evaluated and blended, there is no data-dependent branch.
+template <class Ops>
+inline typename Ops::Double normal_cdf(typename Ops::Double x) {
+    using D = typename Ops::Double;
+    const D zero = Ops::set(0.0);
+    const D a = Ops::max(x, Ops::sub(zero, x));
+    const D gauss = exp<Ops>(Ops::mul(Ops::mul(a, a), Ops::set(-0.5)));
+
+    D numerator = Ops::set(kCdfNumerator[0]);
+    for (int i = 1; i < 7; ++i) {
+        numerator = Ops::add(Ops::mul(numerator, a), Ops::set(kCdfNumerator[i]));
+    }
+    D denominator = Ops::set(kCdfDenominator[0]);
+    for (int i = 1; i < 8; ++i) {
+        denominator = Ops::add(Ops::mul(denominator, a), Ops::set(kCdfDenominator[i]));
+    }
+    const D central = Ops::div(Ops::mul(gauss, numerator), denominator);
+
+    // Continued fraction for the tail, |x| >= 7.07.
+    D fraction = Ops::add(a, Ops::set(0.65));
+    for (int i = 4; i >= 1; --i) {
+        fraction = Ops::add(a, Ops::div(Ops::set(static_cast<double>(i)), fraction));
+    }
+    const D tail = Ops::div(Ops::div(gauss, fraction), Ops::set(2.506628274631));
+
+    const D lower = Ops::select(Ops::less(a, Ops::set(7.07106781186547)), central, tail);  // Phi(-|x|)
+    return Ops::select(Ops::greater(x, zero), Ops::sub(Ops::set(1.0), lower), lower);
+}
+
+// Philox4x32-10 for kWidth paths at once: lane i is path first_path + i.
+// The 32-bit words live in the low half of 64-bit lanes so that mul_low32
+// (vpmuludq) yields the full 64-bit products Philox needs.
+template <class Ops>
+struct PhiloxLanes {
+    using W = typename Ops::Word;
+
+    PhiloxLanes(std::uint64_t seed, std::uint64_t first_path) {
+        // Same schedule as philox::generate(), written out to stay free of shared inline functions.
+        std::uint32_t key0 = static_cast<std::uint32_t>(seed);
+        std::uint32_t key1 = static_cast<std::uint32_t>(seed >> 32);
+        for (int i = 0; i < philox::kRounds; ++i) {
+            round_keys[i][0] = key0;
+            round_keys[i][1] = key1;
+            key0 += philox::kWeyl0;
+            key1 += philox::kWeyl1;
+        }
+        const W paths = Ops::iota_word(first_path);
+        path_lo = Ops::and_word(paths, Ops::set_word(0xFFFFFFFFull));
+        path_hi = Ops::template shift_right<32>(paths);
+    }
+
+    // Two uniforms in (0, 1) per lane from counter block `block`, identical to
+    // philox::to_uniform(philox::generate(make_counter(path, block), key)).
+    void uniforms(std::uint32_t block, typename Ops::Double& u1, typename Ops::Double& u2) const {
+        const W low32 = Ops::set_word(0xFFFFFFFFull);
+        const W m0 = Ops::set_word(philox::kMultiplier0);
+        const W m1 = Ops::set_word(philox::kMultiplier1);
+        W x0 = Ops::set_word(block);
+        W x1 = Ops::set_word(0);
+        W x2 = path_lo;
+        W x3 = path_hi;
+        for (int i = 0; i < philox::kRounds; ++i) {
+            const W p0 = Ops::mul_low32(m0, x0);
+            const W p1 = Ops::mul_low32(m1, x2);
+            const W hi0 = Ops::template shift_right<32>(p0);
+            const W hi1 = Ops::template shift_right<32>(p1);
+            x0 = Ops::xor_word(Ops::xor_word(hi1, x1), Ops::set_word(round_keys[i][0]));
+            x1 = Ops::and_word(p1, low32);
+            x2 = Ops::xor_word(Ops::xor_word(hi0, x3), Ops::set_word(round_keys[i][1]));
+            x3 = Ops::and_word(p0, low32);
+        }
+        u1 = to_uniform(x0, x1);
+        u2 = to_uniform(x2, x3);
+    }
+
+    static typename Ops::Double to_uniform(W hi, W lo) {
+        const W bits52 = Ops::xor_word(Ops::template shift_left<20>(hi), Ops::template shift_right<12>(lo));
+        return Ops::mul(Ops::add(word_to_double<Ops>(bits52), Ops::set(0.5)), Ops::set(0x1.0p-52));
+    }
+
+    std::uint32_t round_keys[philox::kRounds][2];
+    W path_lo;
+    W path_hi;
+};
+
+// Box-Muller: two independent standard normals per lane from two uniforms.
+template <class Ops>
+inline void box_muller(typename Ops::Double u1, typename Ops::Double u2,
+                       typename Ops::Double& z0, typename Ops::Double& z1) {
+    const auto radius = Ops::sqrt(Ops::mul(Ops::set(-2.0), log<Ops>(u1)));
+    typename Ops::Double c;
+    typename Ops::Double s;
+    sincos_2pi<Ops>(u2, c, s);
+    z0 = Ops::mul(radius, c);
+    z1 = Ops::mul(radius, s);
+}
+
+} // namespace vmath
@@ -0,0 +1,70 @@
+// src/qmc.cpp
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <cstdlib>
+#include <chrono>
+#include "pricer/black_scholes.h"
+#include "pricer/qmc_engine.h"
+#include "pricer/simd_engine.h"
+
+// Usage: option_pricer_qmc [max_simulations]      default: 262144 paths (x 252 steps)
+//
+// GOOD: Sobol points fill the unit cube far more evenly than random numbers, and
+// the Brownian bridge hands the best coordinates to the coarse shape of the path.
+// Watch the standard error: Monte Carlo halves it with 4x the paths, QMC with the
+// bridge gets close to 4x smaller.
+int main(int argc, char* argv[]) {
+    OptionData data;
+    data.initial_price = 100.0;
+    data.strike_price = 105.0;
+    data.risk_free_rate = 0.05;
+    data.volatility = 0.20;
+    data.time_to_maturity = 1.0;
+    data.num_steps = 252;
+    const int max_simulations = argc > 1 ? std::atoi(argv[1]) : 262144;
+    const double analytic = black_scholes_call(data);
+    const PathPayoff asian{PathPayoffKind::ArithmeticAsian, true, 0.0};
+
+    std::cout << "QMC Implementation" << std::endl;
+    std::cout << "----------------------" << std::endl;
+    std::cout << "Black-Scholes price: " << std::setprecision(8) << analytic << ", 1 thread, "
+              << QmcConfig{}.replicates << " Owen-scrambled replicates" << std::endl;
+
+    QmcConfig with_bridge;
+    with_bridge.num_threads = 1;
+    QmcConfig without_bridge = with_bridge;
+    without_bridge.brownian_bridge = false;
+
+    for (const char* payoff_name : {"European call", "arithmetic Asian call"}) {
+        const bool is_asian = payoff_name[0] == 'a';
+        std::cout << payoff_name << " (std error):" << std::endl
+                  << "  " << std::setw(8) << "paths" << std::setw(14) << "MC" << std::setw(14) << "QMC"
+                  << std::setw(14) << "QMC+bridge" << std::setw(12) << "MC/QMC+br" << std::setw(14) << "QMC+br ns/ps"
+                  << std::endl;
+        for (int n = 4096; n <= max_simulations; n *= 4) {
+            data.num_simulations = n;
+            const McResult mc = is_asian ? run_monte_carlo_exotic(data, asian, 42, 1) : run_monte_carlo_simd(data, 42, 1);
+            const McResult plain = is_asian ? run_monte_carlo_qmc(data, asian, without_bridge)
+                                            : run_monte_carlo_qmc(data, without_bridge);
+            auto start = std::chrono::high_resolution_clock::now();
+            const McResult bridged = is_asian ? run_monte_carlo_qmc(data, asian, with_bridge)
+                                              : run_monte_carlo_qmc(data, with_bridge);
+            auto end = std::chrono::high_resolution_clock::now();
+            const double ns = std::chrono::duration<double, std::nano>(end - start).count() /
+                              (static_cast<double>(n) * data.num_steps);
+
+            std::cout << "  " << std::setw(8) << n << std::scientific << std::setprecision(2)
+                      << std::setw(14) << mc.std_error << std::setw(14) << plain.std_error
+                      << std::setw(14) << bridged.std_error << std::fixed << std::setprecision(1)
+                      << std::setw(11) << mc.std_error / bridged.std_error << "x"
+                      << std::setw(14) << ns << std::defaultfloat << std::endl;
+            if (!is_asian && n * 4 > max_simulations) {
+                std::cout << "  QMC+bridge price " << std::setprecision(8) << bridged.price
+                          << ", error vs Black-Scholes " << std::scientific << std::setprecision(2)
+                          << bridged.price - analytic << std::defaultfloat << std::endl;
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,75 @@
+#ifndef __CashFlowEngine_h__
+#define __CashFlowEngine_h__
+
+#include <cstddef>
+#include <span>
+
+// A level-payment loan with monthly payments.
+struct Loan {
+    double principal;
+    double annual_rate;          // nominal, compounded monthly
+    int term_months;
+    double upfront_fee = 0.0;    // kept by the lender: the borrower receives principal - fee
+};
+
+struct AmortizationRow {
+    int period;                  // 1 ... term_months
+    double payment;
+    double interest;
+    double principal;            // repaid in this period
+    double balance;              // outstanding after the payment
+};
+
+// The level monthly payment; the last one of a schedule absorbs the rounding so that
+// the balance ends at exactly 0.
+double monthly_payment(const Loan& loan);
+
+// Writes the loan's term_months rows to the front of `rows` and returns their number.
+// Throws std::invalid_argument for a non-positive term or a buffer that is too small.
+std::size_t write_amortization_schedule(const Loan& loan, std::span<AmortizationRow> rows);
+
+// All schedules back to back without allocating: `rows` needs schedule_rows(loans)
+// entries; loan i gets rows [offsets[i], offsets[i + 1]), so offsets has loans.size() + 1.
+std::size_t schedule_rows(std::span<const Loan> loans);
+void write_amortization_schedules(std::span<const Loan> loans, std::span<AmortizationRow> rows,
+                                  std::span<std::size_t> offsets);
+
+// Cash flows of many instruments, time-major: flows[t * instruments + i] is the flow of
+// instrument i at period t (t = 0 is today). Shorter instruments are padded with zeros,
+// which changes neither their NPV nor their IRR. This layout lets one vector instruction
+// discount the same period of several instruments.
+struct CashFlowMatrix {
+    std::span<const double> flows;   // periods * instruments values
+    std::size_t instruments;
+    std::size_t periods;
+};
+
+// The lender's cash flows of `loans` (-(principal - fee) at t = 0, then the payments)
+// into `flows`, which needs loans.size() * (longest term + 1) entries. Returns the
+// number of periods, for CashFlowMatrix. Throws std::invalid_argument if `flows` is too small.
+std::size_t write_loan_cash_flows(std::span<const Loan> loans, std::span<double> flows);
+
+// Net present value at a rate per period.
+double calculate_npv(double rate, std::span<const double> cash_flows);
+// results[i] = NPV of instrument i at rates[i].
+void calculate_npv(const CashFlowMatrix& matrix, std::span<const double> rates, std::span<double> results);
+
+struct IrrOptions {
+    double guess = 0.01;             // per period
+    double tolerance = 1e-12;        // on the Newton step, relative to 1 + rate
+    int max_newton_iterations = 30;  // afterwards Brent's method takes over
+};
+
+// Internal rate of return per period: the rate where the NPV is 0. Newton's method,
+// falling back to Brent's method on a bracketing interval if Newton leaves (-1, inf)
+// or does not converge. NaN if no sign change of the NPV is found.
+double calculate_irr(std::span<const double> cash_flows, const IrrOptions& options = {});
+
+// IRR of every instrument. Blocks of instruments run Newton in lockstep: one pass over
+// the block's rows evaluates NPV and slope for all of them (AVX2 where supported),
+// converged lanes are masked out, and lanes that fail go to Brent's method.
+// Agrees with the scalar function to the tolerance. Throws std::invalid_argument if
+// the sizes do not match.
+void calculate_irr(const CashFlowMatrix& matrix, std::span<double> results, const IrrOptions& options = {});
+
+#endif
@@ -1,6 +1,57 @@
 #ifndef __FinanceCalculator_h__
 #define __FinanceCalculator_h__
 
+#include <span>
+
+// Compounding frequency meaning "continuously": growth exp(rate * years).
+constexpr int kContinuousCompounding = 0;
+
+// (1 + rate)^years by exponentiation by squaring: one multiplication per bit of |years|
+// instead of the general std::pow. constexpr, so tables can be built at compile time
+// (RateTables.h) with the same bits as the runtime functions. The long long overload
+// takes negated int terms (-static_cast<long long>(INT_MIN) does not overflow) and
+// gives the same bits as the int one for every int.
+constexpr double compound_growth_factor(double rate, long long years) {
+    double base = 1.0 + rate;
+    double growth = 1.0;
+    // Magnitude as unsigned, so that LLONG_MIN does not overflow.
+    unsigned long long bits =
+        years < 0 ? 0ULL - static_cast<unsigned long long>(years) : static_cast<unsigned long long>(years);
+    while (bits != 0U) {
+        // Multiply by 1.0 (exact) or base, picked by index: the compiler turns a
+        // conditional multiply into a branch, mispredicted on mixed terms.
+        const double factors[2] = {1.0, base};
+        growth *= factors[bits & 1U];  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index): index is 0 or 1
+        base *= base;
+        bits >>= 1U;
+    }
+    return years < 0 ? 1.0 / growth : growth;
+}
+
+constexpr double compound_growth_factor(double rate, int years) {
+    return compound_growth_factor(rate, static_cast<long long>(years));
+}
+
+// principal * compound_growth_factor(rate, years) (negative years discount).
 double calculate_compound_interest(double principal, double rate, int years);
 
+// principal * (1 + rate / periods_per_year)^(periods_per_year * years) for real-valued
+// years, or principal * exp(rate * years) with kContinuousCompounding.
+// Throws std::invalid_argument if periods_per_year is negative.
+double calculate_compound_interest(double principal, double rate, double years, int periods_per_year);
+
+// Batch versions: results[i] is the scalar function applied to the i-th inputs.
+// The integer one is bit-identical to the scalar function; the real-valued ones use a
+// vectorized exp/log1p where the CPU supports AVX2 and agree with the scalar function
+// to a few ulp, with the same NaN, inf and 0 results at the edges.
+// Throw std::invalid_argument if the spans differ in size.
+void calculate_compound_interest(std::span<const double> principals, std::span<const double> rates,
+                                 std::span<const int> years, std::span<double> results);
+void calculate_compound_interest(std::span<const double> principals, std::span<const double> rates,
+                                 std::span<const double> years, int periods_per_year, std::span<double> results);
+
+// Discounting: amounts[i] due in years[i], valued today (the inverse of compounding).
+void calculate_present_value(std::span<const double> amounts, std::span<const double> rates,
+                             std::span<const double> years, int periods_per_year, std::span<double> results);
+
 #endif
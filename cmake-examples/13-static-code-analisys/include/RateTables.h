@@ -0,0 +1,106 @@
+#ifndef __RateTables_h__
+#define __RateTables_h__
+
+#include "FinanceCalculator.h"
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+// Growth and discount factors of fixed-rate products, computed by the compiler.
+// A quote with a term on the grid (whole years 0 ... MaxYears) is one load and one
+// multiply; other terms fall back to the runtime math of FinanceCalculator.h. The
+// entries are compound_growth_factor() values, so both paths give the same bits.
+
+constexpr int kStandardMaxYears = 30;
+
+template <int RateBasisPoints, int MaxYears = kStandardMaxYears>
+class FixedRateTable {
+    static_assert(MaxYears >= 0, "the grid needs at least the zero term");
+
+public:
+    static constexpr double kRate = RateBasisPoints / 10000.0;
+    static constexpr std::size_t kTerms = static_cast<std::size_t>(MaxYears) + 1;
+
+    // kGrowth[n] = (1 + rate)^n, kDiscount[n] = (1 + rate)^-n.
+    static constexpr std::array<double, kTerms> kGrowth = [] {
+        std::array<double, kTerms> table{};
+        for (std::size_t years = 0; years < table.size(); ++years) {
+            table[years] = compound_growth_factor(kRate, static_cast<int>(years));
+        }
+        return table;
+    }();
+    static constexpr std::array<double, kTerms> kDiscount = [] {
+        std::array<double, kTerms> table{};
+        for (std::size_t years = 0; years < table.size(); ++years) {
+            table[years] = compound_growth_factor(kRate, -static_cast<int>(years));
+        }
+        return table;
+    }();
+
+    static constexpr bool on_grid(int years) { return years >= 0 && years <= MaxYears; }
+
+    static constexpr double compound(double principal, int years) {
+        return principal * (on_grid(years) ? kGrowth[static_cast<std::size_t>(years)]
+                                           : compound_growth_factor(kRate, years));
+    }
+
+    static constexpr double present_value(double amount, int years) {
+        return amount * (on_grid(years) ? kDiscount[static_cast<std::size_t>(years)]
+                                        : compound_growth_factor(kRate, -static_cast<long long>(years)));
+    }
+
+    // Real-valued terms with annual compounding: the table for whole years on the grid.
+    static double compound(double principal, double years) {
+        const double whole = std::floor(years);
+        if (whole == years && whole >= 0.0 && whole <= MaxYears) {
+            return principal * kGrowth[static_cast<std::size_t>(whole)];
+        }
+        return calculate_compound_interest(principal, kRate, years, 1);
+    }
+};
+
+// A menu of fixed-rate products (rates in basis points) on the standard term grid.
+template <int... RateBasisPoints>
+class RateTableGrid {
+public:
+    static constexpr std::size_t kProducts = sizeof...(RateBasisPoints);
+    static constexpr std::size_t kNotOnMenu = kProducts;
+    static constexpr std::array<double, kProducts> kRates = {FixedRateTable<RateBasisPoints>::kRate...};
+
+    // Index of `rate` on the menu, or kNotOnMenu.
+    static constexpr std::size_t find(double rate) {
+        for (std::size_t product = 0; product < kProducts; ++product) {
+            if (kRates[product] == rate) {
+                return product;
+            }
+        }
+        return kNotOnMenu;
+    }
+
+    // The quote of a known product (product < kProducts): no rate search.
+    static constexpr double compound_product(std::size_t product, double principal, int years) {
+        return years >= 0 && years <= kStandardMaxYears
+            ? principal * kGrowth[product][static_cast<std::size_t>(years)]
+            : principal * compound_growth_factor(kRates[product], years);
+    }
+
+    static constexpr double present_value_product(std::size_t product, double amount, int years) {
+        return years >= 0 && years <= kStandardMaxYears
+            ? amount * kDiscount[product][static_cast<std::size_t>(years)]
+            : amount * compound_growth_factor(kRates[product], -static_cast<long long>(years));
+    }
+
+    // Any rate: the table if it is on the menu, calculate_compound_interest otherwise.
+    static double compound(double principal, double rate, int years) {
+        const std::size_t product = find(rate);
+        return product == kNotOnMenu ? calculate_compound_interest(principal, rate, years)
+                                     : compound_product(product, principal, years);
+    }
+
+private:
+    using Row = std::array<double, FixedRateTable<0>::kTerms>;
+    static constexpr std::array<Row, kProducts> kGrowth = {FixedRateTable<RateBasisPoints>::kGrowth...};
+    static constexpr std::array<Row, kProducts> kDiscount = {FixedRateTable<RateBasisPoints>::kDiscount...};
+};
+
+#endif
@@ -0,0 +1,322 @@
+#include "CashFlowEngine.h"
+#include "CompoundKernels.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+// Newton runs on this many instruments at once; their rows stay in L1/L2 between iterations.
+constexpr std::size_t kIrrBlock = 64;
+
+// Calls visit(period, payment, interest, principal_repaid, balance) for every month.
+template <typename Visit>
+void amortize(const Loan& loan, Visit&& visit) {
+    const double rate = loan.annual_rate / 12.0;
+    const double payment = monthly_payment(loan);
+    double balance = loan.principal;
+    for (int period = 1; period <= loan.term_months; ++period) {
+        const double interest = balance * rate;
+        const bool last = period == loan.term_months;
+        const double paid = last ? balance + interest : payment;
+        const double repaid = paid - interest;
+        balance = last ? 0.0 : balance - repaid;
+        visit(period, paid, interest, repaid, balance);
+    }
+}
+
+// NPV of the column flows[0], flows[stride], ... at `rate`, and its derivative by the rate.
+double npv_and_slope(const double* flows, std::size_t stride, std::size_t periods, double rate, double& slope) {
+    const double v = 1.0 / (1.0 + rate);
+    double value = 0.0;
+    double dvalue = 0.0;
+    for (std::size_t t = periods; t-- > 0;) {
+        dvalue = dvalue * v + value;
+        value = value * v + flows[t * stride];
+    }
+    slope = -dvalue * v * v;
+    return value;
+}
+
+double npv_column(const double* flows, std::size_t stride, std::size_t periods, double rate) {
+    double slope = 0.0;
+    return npv_and_slope(flows, stride, periods, rate, slope);
+}
+
+bool newton_converged(double step, double rate, double tolerance) {
+    return std::abs(step) <= tolerance * (1.0 + std::abs(rate));
+}
+
+// Brent's method on the first sign change of the NPV on a grid of rates.
+double brent_irr(const double* flows, std::size_t stride, std::size_t periods, double tolerance) {
+    static constexpr std::array<double, 15> kGrid = {-0.99, -0.9, -0.5, -0.2, -0.05, 0.0, 0.005, 0.01,
+                                                     0.05, 0.2, 0.5, 1.0, 5.0, 10.0, 100.0};
+    double a = kGrid[0];
+    double fa = npv_column(flows, stride, periods, a);
+    double b = std::numeric_limits<double>::quiet_NaN();
+    double fb = 0.0;
+    for (std::size_t i = 1; i < kGrid.size(); ++i) {
+        const double f = npv_column(flows, stride, periods, kGrid[i]);
+        if (std::isfinite(fa) && std::isfinite(f) && (fa <= 0.0) != (f <= 0.0)) {
+            b = kGrid[i];
+            fb = f;
+            break;
+        }
+        a = kGrid[i];
+        fa = f;
+    }
+    if (std::isnan(b)) {
+        return b;
+    }
+
+    // b is the best estimate, a the previous one, c keeps the root bracketed with b.
+    double c = a;
+    double fc = fa;
+    double d = b - a;
+    double e = d;
+    for (int iteration = 0; iteration < 200; ++iteration) {
+        if ((fb > 0.0) == (fc > 0.0)) {
+            c = a;
+            fc = fa;
+            d = b - a;
+            e = d;
+        }
+        if (std::abs(fc) < std::abs(fb)) {
+            a = b;
+            b = c;
+            c = a;
+            fa = fb;
+            fb = fc;
+            fc = fa;
+        }
+        const double tol = 2.0 * std::numeric_limits<double>::epsilon() * std::abs(b) + 0.5 * tolerance;
+        const double half = 0.5 * (c - b);
+        if (std::abs(half) <= tol || fb == 0.0) {
+            return b;
+        }
+        if (std::abs(e) >= tol && std::abs(fa) > std::abs(fb)) {
+            // Inverse quadratic interpolation, or the secant step with two points.
+            const double s = fb / fa;
+            double p = 0.0;
+            double q = 0.0;
+            if (a == c) {
+                p = 2.0 * half * s;
+                q = 1.0 - s;
+            } else {
+                const double r = fb / fc;
+                const double t = fa / fc;
+                p = s * (2.0 * half * t * (t - r) - (b - a) * (r - 1.0));
+                q = (t - 1.0) * (r - 1.0) * (s - 1.0);
+            }
+            if (p > 0.0) {
+                q = -q;
+            }
+            p = std::abs(p);
+            if (2.0 * p < std::min(3.0 * half * q - std::abs(tol * q), std::abs(e * q))) {
+                e = d;
+                d = p / q;
+            } else {
+                d = half;
+                e = d;
+            }
+        } else {
+            d = half;
+            e = d;
+        }
+        a = b;
+        fa = fb;
+        b += std::abs(d) > tol ? d : (half > 0.0 ? tol : -tol);
+        fb = npv_column(flows, stride, periods, b);
+    }
+    return b;
+}
+
+double column_irr(const double* flows, std::size_t stride, std::size_t periods, const IrrOptions& options) {
+    double rate = options.guess;
+    for (int iteration = 0; iteration < options.max_newton_iterations; ++iteration) {
+        double slope = 0.0;
+        const double value = npv_and_slope(flows, stride, periods, rate, slope);
+        const double step = value / slope;
+        const double next = rate - step;
+        if (!std::isfinite(next) || next <= -1.0) {
+            break;
+        }
+        rate = next;
+        if (newton_converged(step, rate, options.tolerance)) {
+            return rate;
+        }
+    }
+    return brent_irr(flows, stride, periods, options.tolerance);
+}
+
+// value/slope of `lanes` neighbouring instruments (see discount_horner_avx2).
+void discount_horner(const double* flows, std::size_t stride, std::size_t periods, const double* v,
+                     double* value, double* slope, std::size_t lanes) {
+#if defined(FINANCE_SIMD_X86)
+    if (cpu_supports_avx2()) {
+        discount_horner_avx2(flows, stride, periods, v, value, slope, lanes);
+        return;
+    }
+#endif
+    std::fill(value, value + lanes, 0.0);
+    std::fill(slope, slope + lanes, 0.0);
+    for (std::size_t t = periods; t-- > 0;) {
+        const double* row = flows + t * stride;
+        for (std::size_t l = 0; l < lanes; ++l) {
+            slope[l] = slope[l] * v[l] + value[l];
+            value[l] = value[l] * v[l] + row[l];
+        }
+    }
+}
+
+void check_matrix(const CashFlowMatrix& matrix, std::size_t results) {
+    if (matrix.flows.size() != matrix.instruments * matrix.periods || results != matrix.instruments) {
+        throw std::invalid_argument("cash flow matrix and results do not match");
+    }
+}
+
+} // namespace
+
+double monthly_payment(const Loan& loan) {
+    if (loan.term_months <= 0) {
+        throw std::invalid_argument("term_months must be positive");
+    }
+    const double rate = loan.annual_rate / 12.0;
+    const double months = loan.term_months;
+    if (rate == 0.0) {
+        return loan.principal / months;
+    }
+    // principal * r / (1 - (1 + r)^-n), with expm1/log1p for small rates.
+    return loan.principal * rate / -std::expm1(-months * std::log1p(rate));
+}
+
+std::size_t write_amortization_schedule(const Loan& loan, std::span<AmortizationRow> rows) {
+    if (loan.term_months <= 0 || rows.size() < static_cast<std::size_t>(loan.term_months)) {
+        throw std::invalid_argument("amortization buffer too small for the term");
+    }
+    amortize(loan, [&](int period, double payment, double interest, double repaid, double balance) {
+        rows[static_cast<std::size_t>(period - 1)] = AmortizationRow{period, payment, interest, repaid, balance};
+    });
+    return static_cast<std::size_t>(loan.term_months);
+}
+
+std::size_t schedule_rows(std::span<const Loan> loans) {
+    std::size_t rows = 0;
+    for (const Loan& loan : loans) {
+        rows += static_cast<std::size_t>(std::max(loan.term_months, 0));
+    }
+    return rows;
+}
+
+void write_amortization_schedules(std::span<const Loan> loans, std::span<AmortizationRow> rows,
+                                  std::span<std::size_t> offsets) {
+    if (offsets.size() != loans.size() + 1 || rows.size() < schedule_rows(loans)) {
+        throw std::invalid_argument("schedule buffers too small for the portfolio");
+    }
+    std::size_t next = 0;
+    for (std::size_t i = 0; i < loans.size(); ++i) {
+        offsets[i] = next;
+        next += write_amortization_schedule(loans[i], rows.subspan(next));
+    }
+    offsets[loans.size()] = next;
+}
+
+std::size_t write_loan_cash_flows(std::span<const Loan> loans, std::span<double> flows) {
+    int longest = 0;
+    for (const Loan& loan : loans) {
+        longest = std::max(longest, loan.term_months);
+    }
+    const std::size_t periods = static_cast<std::size_t>(longest) + 1;
+    const std::size_t count = loans.size();
+    if (flows.size() < count * periods) {
+        throw std::invalid_argument("cash flow buffer too small for the portfolio");
+    }
+    std::fill(flows.begin(), flows.begin() + static_cast<std::ptrdiff_t>(count * periods), 0.0);
+    for (std::size_t i = 0; i < count; ++i) {
+        flows[i] = -(loans[i].principal - loans[i].upfront_fee);
+        amortize(loans[i], [&](int period, double payment, double, double, double) {
+            flows[static_cast<std::size_t>(period) * count + i] = payment;
+        });
+    }
+    return periods;
+}
+
+double calculate_npv(double rate, std::span<const double> cash_flows) {
+    return npv_column(cash_flows.data(), 1, cash_flows.size(), rate);
+}
+
+void calculate_npv(const CashFlowMatrix& matrix, std::span<const double> rates, std::span<double> results) {
+    check_matrix(matrix, results.size());
+    if (rates.size() != matrix.instruments) {
+        throw std::invalid_argument("one rate per instrument expected");
+    }
+    std::array<double, kIrrBlock> v{};
+    std::array<double, kIrrBlock> slope{};
+    for (std::size_t first = 0; first < matrix.instruments; first += kIrrBlock) {
+        const std::size_t lanes = std::min(kIrrBlock, matrix.instruments - first);
+        for (std::size_t l = 0; l < lanes; ++l) {
+            v[l] = 1.0 / (1.0 + rates[first + l]);
+        }
+        discount_horner(matrix.flows.data() + first, matrix.instruments, matrix.periods, v.data(),
+                        results.data() + first, slope.data(), lanes);
+    }
+}
+
+double calculate_irr(std::span<const double> cash_flows, const IrrOptions& options) {
+    return column_irr(cash_flows.data(), 1, cash_flows.size(), options);
+}
+
+void calculate_irr(const CashFlowMatrix& matrix, std::span<double> results, const IrrOptions& options) {
+    check_matrix(matrix, results.size());
+    std::array<double, kIrrBlock> rate{};
+    std::array<double, kIrrBlock> v{};
+    std::array<double, kIrrBlock> value{};
+    std::array<double, kIrrBlock> slope{};
+    // Per-lane masks: still iterating, and Newton gave up (Brent takes over).
+    std::array<bool, kIrrBlock> active{};
+    std::array<bool, kIrrBlock> failed{};
+
+    for (std::size_t first = 0; first < matrix.instruments; first += kIrrBlock) {
+        const std::size_t lanes = std::min(kIrrBlock, matrix.instruments - first);
+        const double* flows = matrix.flows.data() + first;
+        std::fill(rate.begin(), rate.end(), options.guess);
+        std::fill(active.begin(), active.end(), true);
+        std::fill(failed.begin(), failed.end(), false);
+
+        // Lanes that converged keep their rate; the pass still covers the whole block,
+        // which costs less than gathering the active columns.
+        std::size_t remaining = lanes;
+        for (int iteration = 0; iteration < options.max_newton_iterations && remaining > 0; ++iteration) {
+            for (std::size_t l = 0; l < lanes; ++l) {
+                v[l] = 1.0 / (1.0 + rate[l]);
+            }
+            discount_horner(flows, matrix.instruments, matrix.periods, v.data(), value.data(), slope.data(), lanes);
+            for (std::size_t l = 0; l < lanes; ++l) {
+                if (!active[l]) {
+                    continue;
+                }
+                const double step = value[l] / (-slope[l] * v[l] * v[l]);
+                const double next = rate[l] - step;
+                if (!std::isfinite(next) || next <= -1.0) {
+                    active[l] = false;
+                    failed[l] = true;
+                    --remaining;
+                    continue;
+                }
+                rate[l] = next;
+                if (newton_converged(step, next, options.tolerance)) {
+                    active[l] = false;
+                    --remaining;
+                }
+            }
+        }
+
+        for (std::size_t l = 0; l < lanes; ++l) {
+            results[first + l] = active[l] || failed[l]
+                ? brent_irr(flows + l, matrix.instruments, matrix.periods, options.tolerance)
+                : rate[l];
+        }
+    }
+}
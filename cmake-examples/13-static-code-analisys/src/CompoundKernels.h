@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+
+// AVX2 kernels behind the batch APIs of FinanceCalculator.h and CashFlowEngine.h.
+// Only called when cpu_supports_avx2(); raw pointers and no inline library code,
+// because their translation unit is compiled with -mavx2 and must not provide
+// definitions the rest of the program could pick up.
+
+// Whether the kernels below may be called (defined in FinanceCalculator.cpp, which is
+// compiled for the baseline instruction set).
+bool cpu_supports_avx2();
+
+// results[i] = principals[i] * (1 + rates[i])^years[i], with the same multiplications
+// (in the same order) as the scalar exponentiation by squaring.
+void compound_integer_avx2(const double* principals, const double* rates, const int* years,
+                           double* results, std::size_t count);
+
+// results[i] = amounts[i] * exp(direction * g), g = periods * years[i] * log1p(rates[i] / periods),
+// or g = rates[i] * years[i] when periods is 0 (continuous). direction is +1 or -1.
+void compound_real_avx2(const double* amounts, const double* rates, const double* years, double periods,
+                        double direction, double* results, std::size_t count);
+
+// For lanes l < lanes: value[l] = sum_t c_t v[l]^t and slope[l] = sum_t t c_t v[l]^(t-1),
+// with c_t = flows[t * stride + l], by Horner's rule from the last period.
+void discount_horner_avx2(const double* flows, std::size_t stride, std::size_t periods, const double* v,
+                          double* value, double* slope, std::size_t lanes);
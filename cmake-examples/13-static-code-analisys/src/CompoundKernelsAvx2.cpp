@@ -0,0 +1,175 @@
+#include "CompoundKernels.h"
+#include <immintrin.h>
+
+namespace {
+
+constexpr std::size_t kLanes = 4;
+
+// Lanes [0, remaining) enabled, for the masked loads and stores of the last chunk.
+__m256i tail_mask(std::size_t remaining) {
+    const __m256i index = _mm256_setr_epi64x(0, 1, 2, 3);
+    return _mm256_cmpgt_epi64(_mm256_set1_epi64x(static_cast<long long>(remaining)), index);
+}
+
+__m256d load(const double* data, std::size_t remaining) {
+    return remaining >= kLanes ? _mm256_loadu_pd(data) : _mm256_maskload_pd(data, tail_mask(remaining));
+}
+
+void store(double* data, __m256d value, std::size_t remaining) {
+    if (remaining >= kLanes) {
+        _mm256_storeu_pd(data, value);
+    } else {
+        _mm256_maskstore_pd(data, tail_mask(remaining), value);
+    }
+}
+
+// exp(y): y = k ln2 + r with |r| <= ln2 / 2, a degree-13 Taylor polynomial for exp(r)
+// and 2^k applied as two factors 2^(k/2) 2^(k - k/2), each a normal double, so that
+// results near the overflow and underflow limits come out as the scalar exp() gives
+// them: inf above ~709.78, subnormal down to ~-745.13, then 0. About 1 ulp. NaN stays NaN.
+__m256d exp_pd(__m256d y_in) {
+    // Beyond these the result is already inf or 0; clamping keeps k in int32 range.
+    const __m256d y = _mm256_max_pd(_mm256_min_pd(y_in, _mm256_set1_pd(710.0)), _mm256_set1_pd(-746.0));
+    const __m256d k = _mm256_round_pd(_mm256_mul_pd(y, _mm256_set1_pd(1.4426950408889634)),
+                                      _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = _mm256_sub_pd(y, _mm256_mul_pd(k, _mm256_set1_pd(6.93147180369123816490e-01)));
+    r = _mm256_sub_pd(r, _mm256_mul_pd(k, _mm256_set1_pd(1.90821492927058770002e-10)));
+
+    // 1/13!, 1/12!, ..., 1/2!, 1, 1
+    static constexpr double kCoefficients[] = {
+        1.6059043836821613e-10, 2.0876756987868099e-09, 2.5052108385441720e-08, 2.7557319223985893e-07,
+        2.7557319223985888e-06, 2.4801587301587302e-05, 1.9841269841269841e-04, 1.3888888888888889e-03,
+        8.3333333333333332e-03, 4.1666666666666664e-02, 1.6666666666666666e-01, 0.5, 1.0, 1.0,
+    };
+    __m256d p = _mm256_set1_pd(kCoefficients[0]);
+    for (std::size_t i = 1; i < sizeof(kCoefficients) / sizeof(kCoefficients[0]); ++i) {
+        p = _mm256_add_pd(_mm256_mul_pd(p, r), _mm256_set1_pd(kCoefficients[i]));
+    }
+
+    // k in [-1076, 1024]: neither half leaves the normal exponent range.
+    const __m256d k_low = _mm256_floor_pd(_mm256_mul_pd(k, _mm256_set1_pd(0.5)));
+    const __m256d k_high = _mm256_sub_pd(k, k_low);
+    auto power_of_two = [](__m256d n) {
+        const __m256i exponent = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(n));
+        return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_add_epi64(exponent, _mm256_set1_epi64x(1023)), 52));
+    };
+    const __m256d result = _mm256_mul_pd(_mm256_mul_pd(p, power_of_two(k_low)), power_of_two(k_high));
+    // min/max returned the bound for NaN lanes: put the NaN back.
+    return _mm256_blendv_pd(result, y_in, _mm256_cmp_pd(y_in, y_in, _CMP_UNORD_Q));
+}
+
+// log1p(x) for x > -1: u = 1 + x = 2^k f with f in [sqrt(2)/2, sqrt(2)),
+// log f = 2 atanh(s) with s = (f - 1) / (f + 1), plus the rounding error of 1 + x.
+// Outside that domain as std::log1p: -inf at -1, NaN below -1 or for NaN, inf for inf.
+__m256d log1p_pd(__m256d x) {
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d u = _mm256_add_pd(one, x);
+    // (x - (u - 1)) / u is what rounding 1 + x lost, relative to u.
+    const __m256d correction = _mm256_div_pd(_mm256_sub_pd(x, _mm256_sub_pd(u, one)), u);
+
+    // Shift the bits so that the exponent field of hx is k, and f keeps the mantissa.
+    const __m256i sqrt_half_bits = _mm256_set1_epi64x(0x3fe6a09e667f3bcdLL);
+    const __m256i hx = _mm256_add_epi64(_mm256_castpd_si256(u),
+                                        _mm256_sub_epi64(_mm256_set1_epi64x(0x3ff0000000000000LL), sqrt_half_bits));
+    const __m256i magic = _mm256_set1_epi64x(0x4330000000000000LL);  // 2^52
+    const __m256d k = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_add_epi64(_mm256_srli_epi64(hx, 52), magic)),
+                                    _mm256_set1_pd(4503599627370496.0 + 1023.0));
+    const __m256i mantissa = _mm256_and_si256(hx, _mm256_set1_epi64x(0x000fffffffffffffLL));
+    const __m256d f = _mm256_castsi256_pd(_mm256_add_epi64(mantissa, sqrt_half_bits));
+
+    const __m256d s = _mm256_div_pd(_mm256_sub_pd(f, one), _mm256_add_pd(f, one));
+    const __m256d z = _mm256_mul_pd(s, s);
+    // 2 (s + s^3/3 + ... + s^23/23); |s| <= 0.172 so the next term is below 1e-19.
+    __m256d p = _mm256_set1_pd(2.0 / 23.0);
+    for (int n = 21; n >= 3; n -= 2) {
+        p = _mm256_add_pd(_mm256_mul_pd(p, z), _mm256_set1_pd(2.0 / n));
+    }
+    const __m256d log_f = _mm256_add_pd(_mm256_add_pd(s, s), _mm256_mul_pd(_mm256_mul_pd(s, z), p));
+
+    const __m256d low = _mm256_add_pd(_mm256_add_pd(log_f, correction),
+                                      _mm256_mul_pd(k, _mm256_set1_pd(1.90821492927058770002e-10)));
+    __m256d result = _mm256_add_pd(_mm256_mul_pd(k, _mm256_set1_pd(6.93147180369123816490e-01)), low);
+
+    const __m256d minus_one = _mm256_set1_pd(-1.0);
+    const __m256d infinity = _mm256_set1_pd(__builtin_inf());
+    result = _mm256_blendv_pd(result, _mm256_sub_pd(_mm256_setzero_pd(), infinity),
+                              _mm256_cmp_pd(x, minus_one, _CMP_EQ_OQ));
+    result = _mm256_blendv_pd(result, _mm256_set1_pd(__builtin_nan("")), _mm256_cmp_pd(x, minus_one, _CMP_LT_OQ));
+    result = _mm256_blendv_pd(result, infinity, _mm256_cmp_pd(x, infinity, _CMP_EQ_OQ));
+    return _mm256_blendv_pd(result, x, _mm256_cmp_pd(x, x, _CMP_UNORD_Q));
+}
+
+} // namespace
+
+void compound_integer_avx2(const double* principals, const double* rates, const int* years,
+                           double* results, std::size_t count) {
+    const __m128i one_bit = _mm_set1_epi32(1);
+    for (std::size_t i = 0; i < count; i += kLanes) {
+        const std::size_t remaining = count - i;
+        const __m128i n = remaining >= kLanes
+            ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(years + i))
+            : _mm_maskload_epi32(years + i, _mm_cmpgt_epi32(_mm_set1_epi32(static_cast<int>(remaining)),
+                                                            _mm_setr_epi32(0, 1, 2, 3)));
+        const __m256d negative = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm_cmplt_epi32(n, _mm_setzero_si128())));
+
+        // |n| as unsigned bits (INT_MIN stays 2^31), consumed by logical shifts.
+        __m128i bits = _mm_abs_epi32(n);
+        __m256d base = _mm256_add_pd(_mm256_set1_pd(1.0), load(rates + i, remaining));
+        __m256d growth = _mm256_set1_pd(1.0);
+        while (!_mm_testz_si128(bits, bits)) {
+            const __m256d take = _mm256_castsi256_pd(
+                _mm256_cvtepi32_epi64(_mm_cmpeq_epi32(_mm_and_si128(bits, one_bit), one_bit)));
+            growth = _mm256_blendv_pd(growth, _mm256_mul_pd(growth, base), take);
+            base = _mm256_mul_pd(base, base);
+            bits = _mm_srli_epi32(bits, 1);
+        }
+        growth = _mm256_blendv_pd(growth, _mm256_div_pd(_mm256_set1_pd(1.0), growth), negative);
+        store(results + i, _mm256_mul_pd(load(principals + i, remaining), growth), remaining);
+    }
+}
+
+void compound_real_avx2(const double* amounts, const double* rates, const double* years, double periods,
+                        double direction, double* results, std::size_t count) {
+    const __m256d m = _mm256_set1_pd(periods);
+    const __m256d sign = _mm256_set1_pd(direction);
+    for (std::size_t i = 0; i < count; i += kLanes) {
+        const std::size_t remaining = count - i;
+        const __m256d rate = load(rates + i, remaining);
+        const __m256d t = load(years + i, remaining);
+        const __m256d growth = periods > 0.0
+            ? _mm256_mul_pd(_mm256_mul_pd(m, t), log1p_pd(_mm256_div_pd(rate, m)))
+            : _mm256_mul_pd(rate, t);
+        store(results + i, _mm256_mul_pd(load(amounts + i, remaining), exp_pd(_mm256_mul_pd(sign, growth))), remaining);
+    }
+}
+
+void discount_horner_avx2(const double* flows, std::size_t stride, std::size_t periods, const double* v,
+                          double* value, double* slope, std::size_t lanes) {
+    // Four vectors of lanes at a time: each Horner step depends on the previous one,
+    // so independent chains are needed to keep the multiplier and adder busy.
+    constexpr std::size_t kChains = 4;
+    for (std::size_t l = 0; l < lanes; l += kChains * kLanes) {
+        std::size_t remaining[kChains];
+        __m256d factor[kChains];
+        __m256d p[kChains];
+        __m256d dp[kChains];
+        for (std::size_t c = 0; c < kChains; ++c) {
+            const std::size_t lane = l + c * kLanes;
+            remaining[c] = lane < lanes ? lanes - lane : 0;
+            factor[c] = load(v + lane, remaining[c]);
+            p[c] = _mm256_setzero_pd();
+            dp[c] = _mm256_setzero_pd();
+        }
+        for (std::size_t t = periods; t-- > 0;) {
+            const double* row = flows + t * stride + l;
+            for (std::size_t c = 0; c < kChains; ++c) {
+                dp[c] = _mm256_add_pd(_mm256_mul_pd(dp[c], factor[c]), p[c]);
+                p[c] = _mm256_add_pd(_mm256_mul_pd(p[c], factor[c]), load(row + c * kLanes, remaining[c]));
+            }
+        }
+        for (std::size_t c = 0; c < kChains; ++c) {
+            store(value + l + c * kLanes, p[c], remaining[c]);
+            store(slope + l + c * kLanes, dp[c], remaining[c]);
+        }
+    }
+}
@@ -1,6 +1,87 @@
 #include "FinanceCalculator.h"
+#include "CompoundKernels.h"
 #include <cmath>
+#include <stdexcept>
+
+namespace {
+
+// The exponent g of exp(g) = growth over `years`.
+double real_growth_exponent(double rate, double years, double periods) {
+    return periods > 0.0 ? periods * years * std::log1p(rate / periods) : rate * years;
+}
+
+void check_periods(int periods_per_year) {
+    if (periods_per_year < 0) {
+        throw std::invalid_argument("periods_per_year must be positive or kContinuousCompounding");
+    }
+}
+
+template <typename Years>
+void check_sizes(std::span<const double> amounts, std::span<const double> rates, std::span<const Years> years,
+                 std::span<double> results) {
+    if (rates.size() != amounts.size() || years.size() != amounts.size() || results.size() != amounts.size()) {
+        throw std::invalid_argument("batch inputs and results must have the same size");
+    }
+}
+
+void compound_real(std::span<const double> amounts, std::span<const double> rates, std::span<const double> years,
+                   int periods_per_year, double direction, std::span<double> results) {
+    check_periods(periods_per_year);
+    check_sizes(amounts, rates, years, results);
+    const double periods = periods_per_year;
+#if defined(FINANCE_SIMD_X86)
+    if (cpu_supports_avx2()) {
+        compound_real_avx2(amounts.data(), rates.data(), years.data(), periods, direction, results.data(),
+                           amounts.size());
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < amounts.size(); ++i) {
+        results[i] = amounts[i] * std::exp(direction * real_growth_exponent(rates[i], years[i], periods));
+    }
+}
+
+} // namespace
+
+bool cpu_supports_avx2() {
+#if defined(FINANCE_SIMD_X86)
+    static const bool supported = __builtin_cpu_supports("avx2") != 0;
+    return supported;
+#else
+    return false;
+#endif
+}
 
 double calculate_compound_interest(double principal, double rate, int years) {
-    return principal * std::pow(1.0 + rate, years);
+    return principal * compound_growth_factor(rate, years);
+}
+
+double calculate_compound_interest(double principal, double rate, double years, int periods_per_year) {
+    check_periods(periods_per_year);
+    return principal * std::exp(real_growth_exponent(rate, years, periods_per_year));
+}
+
+void calculate_compound_interest(std::span<const double> principals, std::span<const double> rates,
+                                 std::span<const int> years, std::span<double> results) {
+    check_sizes(principals, rates, years, results);
+#if defined(FINANCE_SIMD_X86)
+    if (cpu_supports_avx2()) {
+        // Repeats the multiplications of compound_growth_factor(), lane by lane.
+        compound_integer_avx2(principals.data(), rates.data(), years.data(), results.data(), principals.size());
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < principals.size(); ++i) {
+        results[i] = principals[i] * compound_growth_factor(rates[i], years[i]);
+    }
+}
+
+void calculate_compound_interest(std::span<const double> principals, std::span<const double> rates,
+                                 std::span<const double> years, int periods_per_year, std::span<double> results) {
+    compound_real(principals, rates, years, periods_per_year, 1.0, results);
+}
+
+void calculate_present_value(std::span<const double> amounts, std::span<const double> rates,
+                             std::span<const double> years, int periods_per_year, std::span<double> results) {
+    compound_real(amounts, rates, years, periods_per_year, -1.0, results);
 }
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Timing and comparison helpers shared by the benchmark executables.
+
+// Wall time of one call of `function`, in milliseconds.
+template <typename Function>
+double time_ms(Function&& function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Largest |a[i] - b[i]| / |b[i]|; b is the reference.
+inline double max_relative_difference(const std::vector<double>& a, const std::vector<double>& b) {
+    double worst = 0.0;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        worst = std::max(worst, std::abs(a[i] - b[i]) / std::abs(b[i]));
+    }
+    return worst;
+}
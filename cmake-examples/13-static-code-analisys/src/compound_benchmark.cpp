@@ -0,0 +1,92 @@
+#include "FinanceCalculator.h"
+#include "benchmark_util.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Usage: compound_benchmark [inputs]   (default 10000000)
+// Scalar calls in a loop against the batch API, on the same randomly drawn deposits.
+
+namespace {
+
+void report(const std::string& name, double scalar_ms, double batch_ms, std::size_t inputs, double difference) {
+    const double count = static_cast<double>(inputs);
+    std::cout << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << scalar_ms << " ms" << std::setw(10) << batch_ms << " ms"
+              << std::setprecision(2) << std::setw(8) << scalar_ms * 1e6 / count << " ns"
+              << std::setw(8) << batch_ms * 1e6 / count << " ns"
+              << std::setprecision(1) << std::setw(8) << scalar_ms / batch_ms << "x"
+              << std::scientific << std::setprecision(1) << std::setw(15) << difference << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::size_t inputs = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> principal_dist(1000.0, 1000000.0);
+    std::uniform_real_distribution<double> rate_dist(0.0, 0.15);
+    std::uniform_real_distribution<double> term_dist(0.1, 40.0);
+    std::uniform_int_distribution<int> years_dist(1, 40);
+
+    std::vector<double> principals(inputs);
+    std::vector<double> rates(inputs);
+    std::vector<double> terms(inputs);
+    std::vector<int> years(inputs);
+    for (std::size_t i = 0; i < inputs; ++i) {
+        principals[i] = principal_dist(gen);
+        rates[i] = rate_dist(gen);
+        terms[i] = term_dist(gen);
+        years[i] = years_dist(gen);
+    }
+    std::vector<double> scalar(inputs);
+    std::vector<double> batch(inputs);
+
+    std::cout << "Compound interest, " << inputs << " inputs" << std::endl;
+    std::cout << std::left << std::setw(32) << "" << std::right << std::setw(13) << "scalar" << std::setw(13)
+              << "batch" << std::setw(11) << "scalar" << std::setw(11) << "batch" << std::setw(9) << "speedup"
+              << std::setw(15) << "max rel diff" << std::endl;
+
+    // BAD: the original implementation, std::pow with an integer exponent.
+    const double pow_ms = time_ms([&] {
+        for (std::size_t i = 0; i < inputs; ++i) {
+            scalar[i] = principals[i] * std::pow(1.0 + rates[i], years[i]);
+        }
+    });
+    const double integer_ms = time_ms([&] { calculate_compound_interest(principals, rates, years, batch); });
+    report("integer years (std::pow)", pow_ms, integer_ms, inputs, max_relative_difference(batch, scalar));
+
+    const double squaring_ms = time_ms([&] {
+        for (std::size_t i = 0; i < inputs; ++i) {
+            scalar[i] = calculate_compound_interest(principals[i], rates[i], years[i]);
+        }
+    });
+    report("integer years (squaring)", squaring_ms, integer_ms, inputs, max_relative_difference(batch, scalar));
+
+    for (int periods : {12, 365, kContinuousCompounding}) {
+        const double scalar_ms = time_ms([&] {
+            for (std::size_t i = 0; i < inputs; ++i) {
+                scalar[i] = calculate_compound_interest(principals[i], rates[i], terms[i], periods);
+            }
+        });
+        const double batch_ms = time_ms([&] { calculate_compound_interest(principals, rates, terms, periods, batch); });
+        const std::string name = periods == kContinuousCompounding
+            ? "real years, continuous" : "real years, " + std::to_string(periods) + " periods/year";
+        report(name, scalar_ms, batch_ms, inputs, max_relative_difference(batch, scalar));
+    }
+
+    // Discounting the compounded values must give the principals back.
+    calculate_compound_interest(principals, rates, terms, 12, scalar);
+    const double present_ms = time_ms([&] { calculate_present_value(scalar, rates, terms, 12, batch); });
+    std::cout << "present value, 12 periods/year: " << std::fixed << std::setprecision(1) << present_ms
+              << " ms, max rel diff to principal " << std::scientific << std::setprecision(1)
+              << max_relative_difference(batch, principals) << std::endl;
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include "FinanceCalculator.h"
+#include "RateTables.h"
+#include "benchmark_util.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Usage: rate_table_benchmark [quotes]   (default 10000000)
+// Retail quotes on a menu of fixed-rate products: runtime math against the compile-time tables.
+
+namespace {
+
+// The products on offer: 1.50% ... 5.99%.
+using ProductMenu = RateTableGrid<150, 199, 250, 299, 350, 399, 450, 499, 550, 599>;
+
+struct Quote {
+    std::size_t product;
+    double principal;
+    int years;
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<std::size_t> product_dist(0, ProductMenu::kProducts - 1);
+    std::uniform_real_distribution<double> principal_dist(1000.0, 250000.0);
+    std::uniform_int_distribution<int> years_dist(1, kStandardMaxYears);
+    std::vector<Quote> quotes(count);
+    for (Quote& quote : quotes) {
+        quote = Quote{product_dist(gen), principal_dist(gen), years_dist(gen)};
+    }
+
+    std::vector<double> reference(count);
+    std::vector<double> results(count);
+    std::cout << "Rate tables, " << count << " quotes on " << ProductMenu::kProducts << " products" << std::endl;
+
+    // BAD: the general std::pow for every quote.
+    const double pow_ms = time_ms([&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            reference[i] = quotes[i].principal * std::pow(1.0 + ProductMenu::kRates[quotes[i].product], quotes[i].years);
+        }
+    });
+
+    auto report = [&](const std::string& name, double ms) {
+        std::cout << std::left << std::setw(34) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(8) << ms << " ms" << std::setprecision(2) << std::setw(8)
+                  << ms * 1e6 / static_cast<double>(count) << " ns/quote" << std::setprecision(1)
+                  << std::setw(7) << pow_ms / ms << "x" << std::scientific << std::setprecision(1)
+                  << "   max rel diff to pow " << max_relative_difference(results, reference) << std::endl;
+    };
+    results = reference;
+    report("std::pow", pow_ms);
+
+    const double squaring_ms = time_ms([&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            results[i] = calculate_compound_interest(quotes[i].principal, ProductMenu::kRates[quotes[i].product],
+                                                     quotes[i].years);
+        }
+    });
+    report("calculate_compound_interest", squaring_ms);
+    const std::vector<double> squaring = results;
+
+    const double search_ms = time_ms([&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            results[i] = ProductMenu::compound(quotes[i].principal, ProductMenu::kRates[quotes[i].product],
+                                               quotes[i].years);
+        }
+    });
+    report("table, rate looked up on the menu", search_ms);
+
+    // GOOD: the product is known, the quote is a load and a multiply.
+    const double table_ms = time_ms([&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            results[i] = ProductMenu::compound_product(quotes[i].product, quotes[i].principal, quotes[i].years);
+        }
+    });
+    report("table, known product", table_ms);
+    std::cout << "Table identical to calculate_compound_interest: " << (results == squaring ? "yes" : "NO") << std::endl;
+    return results == squaring ? 0 : 1;
+}
@@ -1,9 +1,238 @@
+#include "CashFlowEngine.h"
 #include "FinanceCalculator.h"
+#include "RateTables.h"
 #include <cassert>
+#include <climits>
 #include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+[[maybe_unused]] bool close(double actual, double expected, double relative) {
+    return std::abs(actual - expected) <= relative * std::abs(expected);
+}
+
+// Batch results against the scalar function, for sizes that leave every possible tail.
+void test_batch_matches_scalar() {
+    for (std::size_t size = 0; size <= 11; ++size) {
+        std::vector<double> principals(size);
+        std::vector<double> rates(size);
+        std::vector<double> terms(size);
+        std::vector<int> years(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            principals[i] = 1000.0 + 250.0 * static_cast<double>(i);
+            rates[i] = -0.02 + 0.015 * static_cast<double>(i);
+            terms[i] = 0.25 + 3.7 * static_cast<double>(i);
+            years[i] = static_cast<int>(i * 7) - 20;
+        }
+        std::vector<double> results(size);
+
+        calculate_compound_interest(principals, rates, years, results);
+        for (std::size_t i = 0; i < size; ++i) {
+            assert(results[i] == calculate_compound_interest(principals[i], rates[i], years[i]));
+        }
+        for (int periods : {1, 4, 12, 365, kContinuousCompounding}) {
+            calculate_compound_interest(principals, rates, terms, periods, results);
+            for (std::size_t i = 0; i < size; ++i) {
+                assert(close(results[i], calculate_compound_interest(principals[i], rates[i], terms[i], periods), 1e-13));
+            }
+            std::vector<double> present(size);
+            calculate_present_value(results, rates, terms, periods, present);
+            for (std::size_t i = 0; i < size; ++i) {
+                assert(close(present[i], principals[i], 1e-13));
+            }
+        }
+    }
+}
+
+// Batch results at the edges of exp/log1p: NaN and infinite inputs, rates at and below
+// -periods, growth beyond exp(708) up to overflow, and discounting into the subnormals.
+void test_batch_special_values() {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    const std::vector<double> rates = {nan, 0.05, 0.05, 0.05, 0.05, -1.0, -1.5, inf, 0.05, 0.05, 0.05};
+    const std::vector<double> terms = {1.0, nan, 14520.0, 14545.0, 14560.0, 2.0, 2.0, 1.0, -15000.0, -16000.0, inf};
+    const std::vector<double> principals(rates.size(), 1000.0);
+    std::vector<double> results(rates.size());
+
+    // An exponent near 709 turns one ulp of rounding in the exponent into ~1e-13 of the result.
+    [[maybe_unused]] auto same = [](double actual, double expected) {
+        if (std::isnan(expected)) {
+            return std::isnan(actual);
+        }
+        return actual == expected ||
+               std::abs(actual - expected) <= 1e-12 * std::abs(expected) + 4 * std::numeric_limits<double>::denorm_min();
+    };
+    for (int periods : {1, 12, kContinuousCompounding}) {
+        calculate_compound_interest(principals, rates, terms, periods, results);
+        for (std::size_t i = 0; i < rates.size(); ++i) {
+            assert(same(results[i], calculate_compound_interest(principals[i], rates[i], terms[i], periods)));
+        }
+        calculate_present_value(principals, rates, terms, periods, results);
+        for (std::size_t i = 0; i < rates.size(); ++i) {
+            assert(same(results[i], calculate_compound_interest(principals[i], rates[i], -terms[i], periods)));
+        }
+    }
+}
+
+// Schedules repay the principal exactly and charge interest on the previous balance.
+void test_amortization() {
+    const Loan loan{200000.0, 0.06, 360};
+    assert(close(monthly_payment(loan), 1199.101050305, 1e-11));
+    assert(close(monthly_payment(Loan{1200.0, 0.0, 12}), 100.0, 1e-15));
+
+    std::vector<AmortizationRow> rows(400);
+    assert(write_amortization_schedule(loan, rows) == 360);
+    double repaid = 0.0;
+    [[maybe_unused]] double balance = loan.principal;
+    for (std::size_t i = 0; i < 360; ++i) {
+        assert(rows[i].period == static_cast<int>(i) + 1);
+        assert(close(rows[i].interest, balance * 0.005, 1e-12));
+        repaid += rows[i].principal;
+        balance = rows[i].balance;
+    }
+    assert(rows[359].balance == 0.0);
+    assert(close(repaid, loan.principal, 1e-12));
+
+    const std::vector<Loan> loans = {loan, Loan{10000.0, 0.1, 12}, Loan{5000.0, 0.0, 1}};
+    std::vector<AmortizationRow> portfolio(schedule_rows(loans));
+    std::vector<std::size_t> offsets(loans.size() + 1);
+    write_amortization_schedules(loans, portfolio, offsets);
+    assert(offsets[1] == 360 && offsets[2] == 372 && offsets[3] == 373);
+    assert(portfolio[372].payment == 5000.0);
+
+    [[maybe_unused]] bool threw = false;
+    try {
+        write_amortization_schedule(loan, std::span<AmortizationRow>(rows).first(359));
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+}
+
+// Batch NPV/IRR against the scalar functions, with a block tail and a Brent fallback.
+void test_npv_irr() {
+    // Without fees the lender's IRR is the note rate; with fees it is higher.
+    std::vector<double> flows = {-1000.0, 300.0, 400.0, 500.0};
+    [[maybe_unused]] const double irr = calculate_irr(flows);
+    assert(std::abs(calculate_npv(irr, flows)) < 1e-9);
+    assert(close(calculate_npv(0.1, flows), -1000.0 + 300.0 / 1.1 + 400.0 / 1.21 + 500.0 / 1.331, 1e-14));
+    assert(std::isnan(calculate_irr(std::vector<double>{100.0, 100.0})));
+
+    // Brent alone, and after Newton starts far away.
+    IrrOptions brent_only;
+    brent_only.max_newton_iterations = 0;
+    assert(close(calculate_irr(flows, brent_only), irr, 1e-10));
+    IrrOptions bad_guess;
+    bad_guess.guess = -0.99;
+    assert(close(calculate_irr(flows, bad_guess), irr, 1e-10));
+
+    std::vector<Loan> loans;
+    for (int i = 0; i < 67; ++i) {
+        loans.push_back(Loan{1000.0 * (i + 1), 0.01 + 0.001 * i, 12 * (1 + i % 30), i % 2 == 0 ? 0.0 : 10.0 * i});
+    }
+    std::vector<double> matrix_flows(loans.size() * 361);
+    const std::size_t periods = write_loan_cash_flows(loans, matrix_flows);
+    assert(periods == 361);
+    const CashFlowMatrix matrix{matrix_flows, loans.size(), periods};
+
+    std::vector<double> results(loans.size());
+    calculate_irr(matrix, results);
+    std::vector<double> rates(loans.size());
+    std::vector<double> npvs(loans.size());
+    for (std::size_t i = 0; i < loans.size(); ++i) {
+        rates[i] = loans[i].annual_rate / 12.0;
+    }
+    calculate_npv(matrix, rates, npvs);
+
+    std::vector<double> column(periods);
+    for (std::size_t i = 0; i < loans.size(); ++i) {
+        for (std::size_t t = 0; t < periods; ++t) {
+            column[t] = matrix_flows[t * loans.size() + i];
+        }
+        assert(close(results[i], calculate_irr(column), 1e-12));
+        assert(std::abs(npvs[i] - calculate_npv(rates[i], column)) < 1e-8);
+        if (loans[i].upfront_fee == 0.0) {
+            assert(close(results[i], rates[i], 1e-10));
+            assert(std::abs(npvs[i]) < 1e-6);
+        } else {
+            assert(results[i] > rates[i]);
+            assert(close(npvs[i], loans[i].upfront_fee, 1e-9));
+        }
+    }
+}
+
+// Built by the compiler: these only compile if the tables are constant expressions.
+static_assert(FixedRateTable<500>::kGrowth[0] == 1.0);
+static_assert(FixedRateTable<500>::kGrowth[30] > 4.32 && FixedRateTable<500>::kGrowth[30] < 4.33);
+static_assert(FixedRateTable<500>::compound(1000.0, 2) == 1000.0 * compound_growth_factor(0.05, 2));
+static_assert(FixedRateTable<0>::present_value(1.0, INT_MIN) == 1.0);  // no overflow negating the term
+static_assert(RateTableGrid<0>::present_value_product(0, 1.0, INT_MIN) == 1.0);
+static_assert(RateTableGrid<150, 250>::find(0.025) == 1);
+static_assert(RateTableGrid<150, 250>::find(0.03) == RateTableGrid<150, 250>::kNotOnMenu);
+
+// Table lookups give the bits of the runtime math, on and off the grid.
+void test_rate_tables() {
+    using Table [[maybe_unused]] = FixedRateTable<375, 10>;
+    for (int years = -5; years <= 15; ++years) {
+        assert(Table::compound(1000.0, years) == calculate_compound_interest(1000.0, 0.0375, years));
+        assert(Table::present_value(1000.0, years) == calculate_compound_interest(1000.0, 0.0375, -years));
+    }
+    assert(Table::present_value(1000.0, INT_MIN) == std::numeric_limits<double>::infinity());
+    assert(Table::compound(1000.0, 4.0) == Table::compound(1000.0, 4));
+    assert(Table::compound(1000.0, 4.5) == calculate_compound_interest(1000.0, 0.0375, 4.5, 1));
+    assert(Table::compound(1000.0, 12.0) == calculate_compound_interest(1000.0, 0.0375, 12.0, 1));
+
+    using Menu [[maybe_unused]] = RateTableGrid<150, 199, 250>;
+    for (int years = 0; years <= 40; ++years) {
+        assert(Menu::compound(500.0, 0.0199, years) == calculate_compound_interest(500.0, 0.0199, years));
+        assert(Menu::compound(500.0, 0.0200, years) == calculate_compound_interest(500.0, 0.0200, years));
+        assert(Menu::present_value_product(2, 500.0, years) == calculate_compound_interest(500.0, 0.025, -years));
+    }
+}
+
+} // namespace
 
 int main() {
     double value = calculate_compound_interest(1000, 0.05, 2);
     assert(std::abs(value - 1102.5) < 0.01);
+
+    // Exponentiation by squaring against std::pow, including discounting and INT_MIN.
+    for (int years = -64; years <= 64; ++years) {
+        assert(close(calculate_compound_interest(1000.0, 0.05, years), 1000.0 * std::pow(1.05, years), 1e-14));
+    }
+    assert(calculate_compound_interest(1.0, 0.0, INT_MIN) == 1.0);
+    assert(calculate_compound_interest(1.0, 1.0, 0) == 1.0);
+
+    // Monthly compounding of 5% over 2.5 years, and the continuous limit.
+    assert(close(calculate_compound_interest(1000.0, 0.05, 2.5, 12), 1000.0 * std::pow(1.0 + 0.05 / 12.0, 30.0), 1e-14));
+    assert(close(calculate_compound_interest(1000.0, 0.05, 2.5, kContinuousCompounding), 1000.0 * std::exp(0.125), 1e-15));
+
+    test_batch_matches_scalar();
+    test_batch_special_values();
+    test_amortization();
+    test_npv_irr();
+    test_rate_tables();
+
+    [[maybe_unused]] bool threw = false;
+    try {
+        calculate_compound_interest(1000.0, 0.05, 1.0, -1);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    threw = false;
+    std::vector<double> two(2, 1.0);
+    std::vector<double> three(3, 1.0);
+    try {
+        calculate_present_value(two, two, three, 12, two);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
     return 0;
 }
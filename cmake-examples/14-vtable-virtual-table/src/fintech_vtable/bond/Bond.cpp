@@ -1,10 +1,11 @@
 #include "fintech_vtable/bond/Bond.h"
+#include "fintech_vtable/portfolio/Positions.h"
 
 Bond::Bond(const std::string& id, double faceVal, double coupon)
     : TradableAsset(id), faceValue(faceVal), couponRate(coupon) {}
 
 // The V-Table for Bond will point to this implementation.
-// For simplicity, we assume its current value is its face value.
+// For simplicity, we assume its current value is its face value (see bond_value()).
 double Bond::getCurrentValue() const {
-    return faceValue;
+    return bond_value(faceValue, couponRate);
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "TradableAsset.h"
 #include "fintech_vtable/stock/Stock.h" 
 #include "fintech_vtable/bond/Bond.h"
+#include "fintech_vtable/portfolio/PartitionedPortfolio.h"
 
 // This function works with any TradableAsset, thanks to polymorphism.
 void print_portfolio_summary(const std::vector<std::unique_ptr<TradableAsset>>& portfolio) {
@@ -27,6 +28,22 @@ void print_portfolio_summary(const std::vector<std::unique_ptr<TradableAsset>>&
     std::cout << "--------------------------------\n";
 }
 
+// The same summary for a portfolio partitioned by asset type. Stocks and bonds are
+// valued from their own arrays with direct, inlined calls; only plugin asset types
+// added through addAsset() are dispatched through the V-Table.
+void print_portfolio_summary(const PartitionedPortfolio& portfolio) {
+    std::cout << "\n--- Portfolio Summary (partitioned) ---\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    portfolio.forEachAsset([](const std::string& id, double value) {
+        std::cout << "Asset ID: " << id
+                  << ", Current Value: $" << value << std::endl;
+    });
+    std::cout << "--------------------------------\n";
+    std::cout << "Total Portfolio Value: $" << portfolio.totalValue() << std::endl;
+    std::cout << "--------------------------------\n";
+}
+
 int main() {
     // Create a portfolio of different asset types.
     std::vector<std::unique_ptr<TradableAsset>> portfolio;
@@ -37,6 +54,13 @@ int main() {
     
     // Process the entire portfolio uniformly.
     print_portfolio_summary(portfolio);
+
+    // The same assets, stored by type instead of as separate heap objects.
+    PartitionedPortfolio partitioned;
+    partitioned.addStock("STK001", "AAPL", 150, 175.50);
+    partitioned.addBond("BND001", 10000.00, 0.05);
+    partitioned.addStock("STK002", "GOOG", 50, 130.25);
+    print_portfolio_summary(partitioned);
     
     // The unique_ptr will automatically call the virtual destructors in the correct order
     // when `portfolio` goes out of scope.
@@ -0,0 +1,115 @@
+#include "fintech_vtable/portfolio/MarkToMarketEngine.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Value of `quantity` units at `price`.
+double position_value(double quantity, double price) {
+    return quantity * price;
+}
+
+} // namespace
+
+MarkToMarketEngine::MarkToMarketEngine(std::size_t instrumentCount, std::size_t accountCount,
+                                       std::size_t sectorCount)
+    : prices(instrumentCount, 0.0),
+      accountTotals(accountCount, 0.0),
+      sectorTotals(sectorCount, 0.0) {}
+
+std::size_t MarkToMarketEngine::addPosition(std::uint32_t instrument, double quantity, std::uint32_t account,
+                                            std::uint32_t sector) {
+    // Every index is checked before the first push_back.
+    const double value = position_value(quantity, prices.at(instrument));
+    double& accountTotal = accountTotals.at(account);
+    double& sectorTotal = sectorTotals.at(sector);
+    instruments.push_back(instrument);
+    quantities.push_back(quantity);
+    accounts.push_back(account);
+    sectors.push_back(sector);
+    values.push_back(value);
+    total += value;
+    accountTotal += value;
+    sectorTotal += value;
+    indexStale = true;
+    return values.size() - 1;
+}
+
+// Counting sort of the positions by instrument: two passes, no comparisons.
+void MarkToMarketEngine::buildIndex() {
+    firstPosition.assign(prices.size() + 1, 0);
+    for (std::uint32_t instrument : instruments) {
+        ++firstPosition[instrument + 1];
+    }
+    for (std::size_t i = 1; i < firstPosition.size(); ++i) {
+        firstPosition[i] += firstPosition[i - 1];
+    }
+    positionsByInstrument.resize(instruments.size());
+    std::vector<std::size_t> next(firstPosition.begin(), firstPosition.end() - 1);
+    for (std::size_t position = 0; position < instruments.size(); ++position) {
+        positionsByInstrument[next[instruments[position]]++] = static_cast<std::uint32_t>(position);
+    }
+    indexStale = false;
+}
+
+void MarkToMarketEngine::applyTick(const PriceTick& tick) {
+    double& price = prices.at(tick.instrument);
+    if (indexStale) {
+        buildIndex();
+    }
+    price = tick.price;
+    const std::size_t end = firstPosition[tick.instrument + 1];
+    for (std::size_t k = firstPosition[tick.instrument]; k < end; ++k) {
+        const std::uint32_t position = positionsByInstrument[k];
+        const double value = position_value(quantities[position], tick.price);
+        const double delta = value - values[position];
+        values[position] = value;
+        total += delta;
+        accountTotals[accounts[position]] += delta;
+        sectorTotals[sectors[position]] += delta;
+    }
+}
+
+void MarkToMarketEngine::applyTicks(const std::vector<PriceTick>& ticks) {
+    for (const PriceTick& tick : ticks) {
+        applyTick(tick);
+    }
+}
+
+void MarkToMarketEngine::recompute() {
+    total = 0.0;
+    std::fill(accountTotals.begin(), accountTotals.end(), 0.0);
+    std::fill(sectorTotals.begin(), sectorTotals.end(), 0.0);
+    for (std::size_t position = 0; position < values.size(); ++position) {
+        const double value = position_value(quantities[position], prices[instruments[position]]);
+        values[position] = value;
+        total += value;
+        accountTotals[accounts[position]] += value;
+        sectorTotals[sectors[position]] += value;
+    }
+}
+
+bool MarkToMarketEngine::isConsistent(double relativeTolerance) const {
+    double expectedTotal = 0.0;
+    double gross = 0.0;
+    std::vector<double> expectedAccounts(accountTotals.size(), 0.0);
+    std::vector<double> expectedSectors(sectorTotals.size(), 0.0);
+    for (std::size_t position = 0; position < values.size(); ++position) {
+        const double value = position_value(quantities[position], prices[instruments[position]]);
+        if (value != values[position]) {
+            return false;
+        }
+        expectedTotal += value;
+        gross += std::abs(value);
+        expectedAccounts[accounts[position]] += value;
+        expectedSectors[sectors[position]] += value;
+    }
+    // Totals are compared against the gross value: a book that nets to zero still
+    // carries the rounding of its largest positions.
+    const double tolerance = relativeTolerance * std::max(gross, 1.0);
+    auto close = [tolerance](double a, double b) { return std::abs(a - b) <= tolerance; };
+    return close(total, expectedTotal)
+        && std::equal(accountTotals.begin(), accountTotals.end(), expectedAccounts.begin(), close)
+        && std::equal(sectorTotals.begin(), sectorTotals.end(), expectedSectors.begin(), close);
+}
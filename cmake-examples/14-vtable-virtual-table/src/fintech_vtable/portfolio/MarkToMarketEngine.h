@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// One new price for one instrument.
+struct PriceTick {
+    std::uint32_t instrument;
+    double price;
+};
+
+// Mark-to-market valuation that follows the market tick by tick.
+//
+// The engine keeps the value of every position and running totals for the book,
+// for each account and for each sector. A tick on an instrument only touches that
+// instrument's positions (found through a CSR index) and adds their value changes
+// to the totals, so its cost depends on the positions it moves, not on the size
+// of the book. recompute() rebuilds everything from the prices, both as a
+// consistency check and to drop the rounding drift of many small deltas.
+//
+// The engine is a standalone model of a book: positions are plain (instrument,
+// quantity, account, sector) records valued as quantity * price, not TradableAsset
+// objects, and it is not fed from PartitionedPortfolio.
+//
+// Instrument, account, sector and position indices are checked: an index outside
+// the sizes given to the constructor (or the positions added) throws
+// std::out_of_range, as std::vector::at does.
+class MarkToMarketEngine {
+public:
+    MarkToMarketEngine(std::size_t instrumentCount, std::size_t accountCount, std::size_t sectorCount);
+
+    // Adds a position of `quantity` units (shares, or bonds per 100 face) and
+    // returns its index. The position is valued at the instrument's current price.
+    // The engine is unchanged if an index is out of range.
+    std::size_t addPosition(std::uint32_t instrument, double quantity, std::uint32_t account,
+                            std::uint32_t sector);
+
+    // Sets a price without the incremental path; call recompute() afterwards.
+    // Meant for loading the opening prices before the first tick.
+    void setPrice(std::uint32_t instrument, double price) { prices.at(instrument) = price; }
+
+    void applyTick(const PriceTick& tick);
+    // Applies the ticks in order; a later tick on the same instrument wins. If a tick
+    // throws, the ticks before it stay applied.
+    void applyTicks(const std::vector<PriceTick>& ticks);
+
+    double totalValue() const { return total; }
+    double accountValue(std::uint32_t account) const { return accountTotals.at(account); }
+    double sectorValue(std::uint32_t sector) const { return sectorTotals.at(sector); }
+    double positionValue(std::size_t position) const { return values.at(position); }
+    double price(std::uint32_t instrument) const { return prices.at(instrument); }
+    std::size_t positionCount() const { return values.size(); }
+
+    // Revalues every position from the prices and replaces the running totals.
+    void recompute();
+
+    // Whether the running totals agree with a full revaluation to `relativeTolerance`
+    // (of the book's gross value). Does not modify the engine.
+    bool isConsistent(double relativeTolerance = 1e-9) const;
+
+private:
+    void buildIndex();
+
+    // Prices by instrument.
+    std::vector<double> prices;
+
+    // Positions, one entry per position in every array.
+    std::vector<std::uint32_t> instruments;
+    std::vector<double> quantities;
+    std::vector<std::uint32_t> accounts;
+    std::vector<std::uint32_t> sectors;
+    std::vector<double> values;
+
+    // CSR index: the positions of instrument i are
+    // positionsByInstrument[firstPosition[i]] ... positionsByInstrument[firstPosition[i + 1] - 1].
+    // Rebuilt on the first tick after positions were added.
+    std::vector<std::size_t> firstPosition;
+    std::vector<std::uint32_t> positionsByInstrument;
+    bool indexStale = true;
+
+    double total = 0.0;
+    std::vector<double> accountTotals;
+    std::vector<double> sectorTotals;
+};
@@ -0,0 +1,53 @@
+#include "fintech_vtable/portfolio/PartitionedPortfolio.h"
+
+void PartitionedPortfolio::reserve(std::size_t stockCount, std::size_t bondCount) {
+    stocks.ids.reserve(stockCount);
+    stocks.symbols.reserve(stockCount);
+    stocks.shares.reserve(stockCount);
+    stocks.prices.reserve(stockCount);
+    bonds.ids.reserve(bondCount);
+    bonds.faceValues.reserve(bondCount);
+    bonds.couponRates.reserve(bondCount);
+}
+
+void PartitionedPortfolio::addStock(std::string id, std::string symbol, int shares, double price) {
+    stocks.ids.push_back(std::move(id));
+    stocks.symbols.push_back(std::move(symbol));
+    stocks.shares.push_back(shares);
+    stocks.prices.push_back(price);
+}
+
+void PartitionedPortfolio::addBond(std::string id, double faceValue, double coupon) {
+    bonds.ids.push_back(std::move(id));
+    bonds.faceValues.push_back(faceValue);
+    bonds.couponRates.push_back(coupon);
+}
+
+void PartitionedPortfolio::addAsset(std::unique_ptr<TradableAsset> asset) {
+    others.push_back(std::move(asset));
+}
+
+// Only the two numeric arrays are read: the ids and symbols stay out of the cache.
+double PartitionedPortfolio::stocksValue() const {
+    double total = 0.0;
+    for (std::size_t i = 0; i < stocks.shares.size(); ++i) {
+        total += stock_value(stocks.shares[i], stocks.prices[i]);
+    }
+    return total;
+}
+
+double PartitionedPortfolio::bondsValue() const {
+    double total = 0.0;
+    for (std::size_t i = 0; i < bonds.faceValues.size(); ++i) {
+        total += bond_value(bonds.faceValues[i], bonds.couponRates[i]);
+    }
+    return total;
+}
+
+double PartitionedPortfolio::othersValue() const {
+    double total = 0.0;
+    for (const auto& asset : others) {
+        total += asset->getCurrentValue();
+    }
+    return total;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fintech_vtable/TradableAsset.h"
+#include "fintech_vtable/portfolio/Positions.h"
+
+// A portfolio partitioned by asset type. Stocks and bonds live in per-type arrays
+// (one array per field), so valuing a partition is a tight loop over contiguous
+// numbers with no indirect call. Asset types the portfolio does not know about
+// (plugins) still go through the virtual TradableAsset interface.
+class PartitionedPortfolio {
+public:
+    void reserve(std::size_t stockCount, std::size_t bondCount);
+    void addStock(std::string id, std::string symbol, int shares, double price);
+    void addBond(std::string id, double faceValue, double coupon);
+    void addAsset(std::unique_ptr<TradableAsset> asset);
+
+    std::size_t size() const { return stocks.ids.size() + bonds.ids.size() + others.size(); }
+
+    double stocksValue() const;
+    double bondsValue() const;
+    double othersValue() const;
+    double totalValue() const { return stocksValue() + bondsValue() + othersValue(); }
+
+    // Calls visit(id, value) for every asset: stocks, then bonds, then the others.
+    template <typename Visit>
+    void forEachAsset(Visit&& visit) const {
+        for (std::size_t i = 0; i < stocks.ids.size(); ++i) {
+            visit(stocks.ids[i], stock_value(stocks.shares[i], stocks.prices[i]));
+        }
+        for (std::size_t i = 0; i < bonds.ids.size(); ++i) {
+            visit(bonds.ids[i], bond_value(bonds.faceValues[i], bonds.couponRates[i]));
+        }
+        for (const auto& asset : others) {
+            visit(asset->getId(), asset->getCurrentValue());
+        }
+    }
+
+private:
+    struct Stocks {
+        std::vector<std::string> ids;
+        std::vector<std::string> symbols;
+        std::vector<int> shares;
+        std::vector<double> prices;
+    };
+    struct Bonds {
+        std::vector<std::string> ids;
+        std::vector<double> faceValues;
+        std::vector<double> couponRates;
+    };
+
+    Stocks stocks;
+    Bonds bonds;
+    std::vector<std::unique_ptr<TradableAsset>> others;
+};
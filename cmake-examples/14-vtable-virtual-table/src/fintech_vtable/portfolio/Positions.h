@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+
+// Valuation formulas of the concrete assets, inline so that the compiler can see
+// through them. Stock::getCurrentValue() and Bond::getCurrentValue() use the same
+// functions, so every portfolio layout values an asset identically.
+inline double stock_value(int shares, double price) {
+    return shares * price;
+}
+
+// For simplicity, a bond is valued at its face value.
+inline double bond_value(double faceValue, double /*couponRate*/) {
+    return faceValue;
+}
+
+// Plain records of the same assets: no vptr, no heap node of their own.
+struct StockPosition {
+    std::string id;
+    std::string symbol;
+    int shares;
+    double price;
+
+    double getCurrentValue() const { return stock_value(shares, price); }
+};
+
+struct BondPosition {
+    std::string id;
+    double faceValue;
+    double couponRate;
+
+    double getCurrentValue() const { return bond_value(faceValue, couponRate); }
+};
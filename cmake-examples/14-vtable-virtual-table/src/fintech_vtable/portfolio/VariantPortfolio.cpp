@@ -0,0 +1,21 @@
+#include "fintech_vtable/portfolio/VariantPortfolio.h"
+
+void VariantPortfolio::reserve(std::size_t count) {
+    assets.reserve(count);
+}
+
+void VariantPortfolio::addStock(std::string id, std::string symbol, int shares, double price) {
+    assets.emplace_back(StockPosition{std::move(id), std::move(symbol), shares, price});
+}
+
+void VariantPortfolio::addBond(std::string id, double faceValue, double coupon) {
+    assets.emplace_back(BondPosition{std::move(id), faceValue, coupon});
+}
+
+double VariantPortfolio::totalValue() const {
+    double total = 0.0;
+    for (const AssetRecord& asset : assets) {
+        total += std::visit([](const auto& position) { return position.getCurrentValue(); }, asset);
+    }
+    return total;
+}
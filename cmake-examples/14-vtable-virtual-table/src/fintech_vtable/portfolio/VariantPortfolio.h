@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "fintech_vtable/portfolio/Positions.h"
+
+// A closed set of asset types stored by value in one array. std::visit dispatches
+// on the variant's index, and both alternatives are visible to the compiler, so the
+// valuation is inlined instead of reached through a vptr.
+using AssetRecord = std::variant<StockPosition, BondPosition>;
+
+class VariantPortfolio {
+public:
+    void reserve(std::size_t assets);
+    void addStock(std::string id, std::string symbol, int shares, double price);
+    void addBond(std::string id, double faceValue, double coupon);
+
+    std::size_t size() const { return assets.size(); }
+    const std::vector<AssetRecord>& records() const { return assets; }
+
+    double totalValue() const;
+
+private:
+    std::vector<AssetRecord> assets;
+};
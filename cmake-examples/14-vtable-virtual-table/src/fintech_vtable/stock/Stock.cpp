@@ -1,4 +1,5 @@
 #include "fintech_vtable/stock/Stock.h"
+#include "fintech_vtable/portfolio/Positions.h"
 
 Stock::Stock(const std::string& id, std::string symbol, int shares, double price)
     : TradableAsset(id), 
@@ -8,5 +9,5 @@ Stock::Stock(const std::string& id, std::string symbol, int shares, double price
 
 // The V-Table for Stock will point to this implementation.
 double Stock::getCurrentValue() const {
-    return numShares * pricePerShare;
+    return stock_value(numShares, pricePerShare);
 }
\ No newline at end of file
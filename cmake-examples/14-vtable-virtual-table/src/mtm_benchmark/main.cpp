@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "fintech_vtable/portfolio/MarkToMarketEngine.h"
+
+// Usage: mtm_benchmark [positions] [batches]   (default 5000000 positions, 10000 batches)
+// A book of positions on 1 instrument per 5 positions, marked by batches of 100 ticks.
+// Compares the incremental update with revaluing the whole book after every batch,
+// then checks the running totals against a full revaluation.
+// Build in Release (-DCMAKE_BUILD_TYPE=Release) for meaningful numbers.
+
+namespace {
+
+constexpr std::size_t kTicksPerBatch = 100;
+constexpr std::size_t kAccounts = 1000;
+constexpr std::size_t kSectors = 11;
+
+template <typename Function>
+double time_ms(Function&& function) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::size_t positionCount = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5000000;
+    const std::size_t batchCount = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10000;
+    const std::size_t instrumentCount = std::max<std::size_t>(positionCount / 5, 1);
+
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> priceDist(5.0, 500.0);
+    std::uniform_int_distribution<std::uint32_t> instrumentDist(0, static_cast<std::uint32_t>(instrumentCount - 1));
+    std::uniform_int_distribution<std::uint32_t> accountDist(0, kAccounts - 1);
+    std::uniform_real_distribution<double> quantityDist(-2000.0, 5000.0);  // Short positions included.
+    std::normal_distribution<double> moveDist(0.0, 0.001);
+
+    MarkToMarketEngine engine(instrumentCount, kAccounts, kSectors);
+    for (std::uint32_t instrument = 0; instrument < instrumentCount; ++instrument) {
+        engine.setPrice(instrument, priceDist(gen));
+    }
+    for (std::size_t i = 0; i < positionCount; ++i) {
+        const std::uint32_t instrument = instrumentDist(gen);
+        // The sector belongs to the instrument.
+        engine.addPosition(instrument, std::round(quantityDist(gen)), accountDist(gen),
+                           instrument % kSectors);
+    }
+
+    // The ticks, generated up front: a random walk on random instruments.
+    std::vector<std::vector<PriceTick>> batches(batchCount);
+    {
+        std::vector<double> prices(instrumentCount);
+        for (std::uint32_t instrument = 0; instrument < instrumentCount; ++instrument) {
+            prices[instrument] = engine.price(instrument);
+        }
+        for (auto& batch : batches) {
+            batch.resize(kTicksPerBatch);
+            for (PriceTick& tick : batch) {
+                tick.instrument = instrumentDist(gen);
+                prices[tick.instrument] *= 1.0 + moveDist(gen);
+                tick.price = prices[tick.instrument];
+            }
+        }
+    }
+
+    std::cout << "Mark-to-market, " << positionCount << " positions on " << instrumentCount << " instruments, "
+              << batchCount << " batches of " << kTicksPerBatch << " ticks" << std::endl;
+
+    // BAD: revalue the whole book whenever prices move.
+    double recomputeMs = 0.0;
+    for (int run = 0; run < 3; ++run) {
+        const double ms = time_ms([&] { engine.recompute(); });
+        recomputeMs = run == 0 ? ms : std::min(recomputeMs, ms);
+    }
+    const double openingTotal = engine.totalValue();
+
+    // GOOD: apply each batch as deltas to the affected positions and aggregates.
+    const double incrementalMs = time_ms([&] {
+        for (const auto& batch : batches) {
+            engine.applyTicks(batch);
+        }
+    });
+    const double perBatchUs = incrementalMs * 1e3 / static_cast<double>(batchCount);
+    const double tickCount = static_cast<double>(batchCount * kTicksPerBatch);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Full revaluation:   " << recomputeMs << " ms per batch" << std::endl;
+    std::cout << "Incremental:        " << perBatchUs << " us per batch, "
+              << tickCount / incrementalMs / 1e3 << " M ticks/s (" << recomputeMs * 1e3 / perBatchUs
+              << "x)" << std::endl;
+
+    // The consistency check, then the full recompute that resets the drift.
+    const bool consistent = engine.isConsistent();
+    const double runningTotal = engine.totalValue();
+    const double checkMs = time_ms([&] { engine.recompute(); });
+    std::cout << "Book value:         " << openingTotal << " -> " << engine.totalValue() << std::endl;
+    std::cout << "Running total drift after " << batchCount * kTicksPerBatch << " ticks: " << std::scientific
+              << std::setprecision(1) << std::abs(runningTotal - engine.totalValue()) << std::fixed
+              << std::setprecision(2) << " (recompute " << checkMs << " ms)" << std::endl;
+    std::cout << "Consistency check: " << (consistent ? "passed" : "FAILED") << std::endl;
+    return consistent ? 0 : 1;
+}
@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "fintech_vtable/TradableAsset.h"
+#include "fintech_vtable/bond/Bond.h"
+#include "fintech_vtable/portfolio/PartitionedPortfolio.h"
+#include "fintech_vtable/portfolio/VariantPortfolio.h"
+#include "fintech_vtable/stock/Stock.h"
+
+// Usage: portfolio_benchmark [assets]   (default 10000000)
+// Values the same book of stocks and bonds in three layouts:
+//   1. std::vector<std::unique_ptr<TradableAsset>>: one heap object per asset, virtual call.
+//   2. std::vector<std::variant<StockPosition, BondPosition>>: by value, std::visit.
+//   3. PartitionedPortfolio: one array per type and field, tight loop per partition.
+// Build in Release (-DCMAKE_BUILD_TYPE=Release) for meaningful numbers.
+
+namespace {
+
+struct AssetSpec {
+    bool isStock;
+    int shares;
+    double price;  // Share price for a stock, face value for a bond.
+};
+
+// Best of a few runs: the book is valued repeatedly in production, so warm caches
+// and trained predictors are the fair comparison.
+template <typename Value>
+double best_time_ms(Value&& value, double& total) {
+    double best = 0.0;
+    for (int run = 0; run < 5; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        total = value();
+        const auto end = std::chrono::steady_clock::now();
+        const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        best = run == 0 ? ms : std::min(best, ms);
+    }
+    return best;
+}
+
+void report(const std::string& layout, double ms, double baselineMs, std::size_t count, double total,
+            double reference) {
+    std::cout << std::left << std::setw(36) << layout << std::right << std::fixed << std::setprecision(1)
+              << std::setw(8) << ms << " ms" << std::setprecision(2) << std::setw(7)
+              << ms * 1e6 / static_cast<double>(count) << " ns/asset" << std::setprecision(1) << std::setw(7)
+              << baselineMs / ms << "x" << std::scientific << std::setprecision(1)
+              << "   rel. diff " << std::abs(total - reference) / reference << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+    // The book: 60% stocks, 40% bonds, interleaved at random.
+    std::mt19937_64 gen(42);
+    std::bernoulli_distribution isStock(0.6);
+    std::uniform_int_distribution<int> sharesDist(1, 5000);
+    std::uniform_real_distribution<double> priceDist(5.0, 900.0);
+    std::uniform_real_distribution<double> faceDist(1000.0, 100000.0);
+    std::vector<AssetSpec> specs(count);
+    std::size_t stockCount = 0;
+    for (AssetSpec& spec : specs) {
+        spec.isStock = isStock(gen);
+        spec.shares = spec.isStock ? sharesDist(gen) : 0;
+        spec.price = spec.isStock ? priceDist(gen) : faceDist(gen);
+        stockCount += spec.isStock ? 1 : 0;
+    }
+    auto idOf = [](std::size_t i) { return "A" + std::to_string(i); };
+
+    std::cout << "Portfolio valuation, " << count << " assets (" << stockCount << " stocks)" << std::endl;
+
+    // Layouts are built one at a time, so the peak memory is one book.
+    double reference = 0.0;
+    double baselineMs = 0.0;
+    {
+        std::vector<std::unique_ptr<TradableAsset>> book;
+        book.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (specs[i].isStock) {
+                book.push_back(std::make_unique<Stock>(idOf(i), "SYM", specs[i].shares, specs[i].price));
+            } else {
+                book.push_back(std::make_unique<Bond>(idOf(i), specs[i].price, 0.05));
+            }
+        }
+        auto value = [&] {
+            double total = 0.0;
+            for (const auto& asset : book) {
+                total += asset->getCurrentValue();
+            }
+            return total;
+        };
+        baselineMs = best_time_ms(value, reference);
+        report("virtual, allocation order", baselineMs, baselineMs, count, reference, reference);
+
+        // A long-lived book is not in allocation order: trades come and go and the
+        // heap nodes end up scattered. Shuffling the pointers models that.
+        std::shuffle(book.begin(), book.end(), gen);
+        double total = 0.0;
+        const double ms = best_time_ms(value, total);
+        report("virtual, scattered heap nodes", ms, baselineMs, count, total, reference);
+
+        // ~TradableAsset() logs every asset; keep 10M lines out of the report.
+        std::cout.setstate(std::ios::failbit);
+        book.clear();
+        std::cout.clear();
+    }
+    {
+        VariantPortfolio book;
+        book.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (specs[i].isStock) {
+                book.addStock(idOf(i), "SYM", specs[i].shares, specs[i].price);
+            } else {
+                book.addBond(idOf(i), specs[i].price, 0.05);
+            }
+        }
+        double total = 0.0;
+        const double ms = best_time_ms([&] { return book.totalValue(); }, total);
+        report("std::variant vector", ms, baselineMs, count, total, reference);
+    }
+    {
+        PartitionedPortfolio book;
+        book.reserve(stockCount, count - stockCount);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (specs[i].isStock) {
+                book.addStock(idOf(i), "SYM", specs[i].shares, specs[i].price);
+            } else {
+                book.addBond(idOf(i), specs[i].price, 0.05);
+            }
+        }
+        double total = 0.0;
+        const double ms = best_time_ms([&] { return book.totalValue(); }, total);
+        report("partitioned by type", ms, baselineMs, count, total, reference);
+    }
+    return 0;
+}